@@ -0,0 +1,228 @@
+/**
+ * @file    benchmark/benchmark.cpp
+ * @brief   Implementation of small benchmark harness for ken3.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <new>
+#include "ken3/stopwatch.hpp"
+#include "benchmark/benchmark.hpp"
+
+namespace {
+
+// allocated bytes by operator new since program starts
+std::atomic<std::size_t> allocated(0);
+
+// destination of bench::keep()
+const void* volatile sink = nullptr;
+
+/**
+ * @brief      measure average time of one call.
+ * @param[in]  i: appointed item.
+ * @param[in]  in: input of item.
+ * @return     ns/op. best of some repeats.
+ */
+double measure_ns(const bench::item& i, const bench::input& in)
+{
+    const double min_ns = 2.0e7; // each repeat runs 20ms at least
+    const int repeats = 5;
+
+    // calibrate the number of iterations
+    std::size_t n = 1;
+    for (;;) {
+        ken3::stopwatch sw(true);
+        for (std::size_t j = 0; j < n; j++) {
+            i.func(in);
+        }
+        double elapsed = sw.ns();
+        if (elapsed >= min_ns) {
+            break;
+        }
+        n = (elapsed <= 0.0) ? n * 16 : std::max(n * 2, static_cast<std::size_t>(n * min_ns / elapsed * 1.2));
+    }
+
+    double best = 0.0;
+    for (int r = 0; r < repeats; r++) {
+        ken3::stopwatch sw(true);
+        for (std::size_t j = 0; j < n; j++) {
+            i.func(in);
+        }
+        double ns = sw.ns() / static_cast<double>(n);
+        best = (r == 0) ? ns : std::min(best, ns);
+    }
+    return best;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      measure allocated bytes of one call.
+ * @param[in]  i: appointed item.
+ * @param[in]  in: input of item.
+ * @return     bytes/op.
+ */
+std::size_t measure_bytes(const bench::item& i, const bench::input& in)
+{
+    std::size_t before = allocated.load();
+    i.func(in);
+    return allocated.load() - before;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace {
+
+/**
+ * @brief      replaced operator new, which counts allocated bytes.
+ */
+void* operator new(std::size_t size)
+{
+    allocated.fetch_add(size, std::memory_order_relaxed);
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      replaced operator delete, which is a pair of operator new.
+ */
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+namespace bench {
+
+/**
+ * @brief      constructor. creates text of appointed size and its parts.
+ * @param[in]  size: size of text in bytes.
+ */
+input::input(std::size_t size) :
+    s(make_text(size)),
+    t(s.begin(), s.end()),
+    h(s.substr(0, 3)),
+    w(s.size() < 3 ? s : s.substr(s.size() - 3)),
+    v()
+{
+    std::string::size_type pos = 0;
+    for (;;) {
+        pos = s.find_first_not_of(" \t\n", pos);
+        if (pos == std::string::npos) {
+            break;
+        }
+        std::string::size_type last = s.find_first_of(" \t\n", pos);
+        v.push_back(s.substr(pos, last - pos));
+        pos = last;
+    }
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      create a deterministic text. the same text is made by
+ *             make_text() in benchmark creator scripts.
+ * @param[in]  size: size of text in bytes.
+ * @return     created text.
+ */
+std::string make_text(std::size_t size)
+{
+    static const std::string pattern =
+        "The quick brown fox jumps over the lazy dog.\t"
+        "Sphinx of black quartz, judge my vow!\n";
+
+    std::string text;
+    text.reserve(size);
+    while (text.size() < size) {
+        text.append(pattern, 0, std::min(pattern.size(), size - text.size()));
+    }
+    return text;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      prevent the compiler from removing a computation.
+ * @param[in]  p: address of the result of computation.
+ */
+void keep(const void* p)
+{
+    sink = p;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      run benchmark items and print results.
+ * @param[in]  items: first item.
+ * @param[in]  size: the number of items.
+ * @param[in]  argc: argc of main().
+ * @param[in]  argv: argv of main().
+ * @return     exit code. 0: OK, 1: ratio check failed, 2: wrong arguments.
+ */
+int run(const item* items, std::size_t size, int argc, char* argv[])
+{
+    const char* filter = "";
+    double max_ratio = 0.0;
+    for (int i = 1; i < argc; i++) {
+        if ((std::strcmp(argv[i], "--filter") == 0) && (i + 1 < argc)) {
+            filter = argv[++i];
+        }
+        else if ((std::strcmp(argv[i], "--max-ratio") == 0) && (i + 1 < argc)) {
+            max_ratio = std::atof(argv[++i]);
+        }
+        else {
+            std::fprintf(stderr, "usage: %s [--filter TEXT] [--max-ratio R]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    std::printf("%-24s %10s %14s %14s %14s %8s\n",
+                "name", "size", "ns/op", "bytes/op", "reference", "ratio");
+
+    std::map<std::size_t, std::unique_ptr<input>> inputs;
+    int failed = 0;
+    for (std::size_t i = 0; i < size; i++) {
+        const item& it = items[i];
+        if (std::strstr(it.name, filter) == nullptr) {
+            continue;
+        }
+
+        std::unique_ptr<input>& in = inputs[it.size];
+        if (!in) {
+            in.reset(new input(it.size));
+        }
+
+        double ns = measure_ns(it, *in);
+        std::size_t bytes = measure_bytes(it, *in);
+        if (it.reference_ns > 0.0) {
+            double ratio = ns / it.reference_ns;
+            bool ng = (max_ratio > 0.0) && (ratio > max_ratio);
+            failed += ng ? 1 : 0;
+            std::printf("%-24s %10zu %14.1f %14zu %14.1f %8.3f%s\n",
+                        it.name, it.size, ns, bytes, it.reference_ns, ratio, ng ? "  NG" : "");
+        }
+        else {
+            std::printf("%-24s %10zu %14.1f %14zu %14s %8s\n",
+                        it.name, it.size, ns, bytes, "-", "-");
+        }
+        std::fflush(stdout);
+    }
+
+    if (failed != 0) {
+        std::printf("%d item(s) exceed max ratio %.3f\n", failed, max_ratio);
+        return 1;
+    }
+    return 0;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace bench {
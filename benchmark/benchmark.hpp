@@ -0,0 +1,105 @@
+/**
+ * @file    benchmark/benchmark.hpp
+ * @brief   Small benchmark harness for ken3 based on ken3::stopwatch.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ *
+ * @note
+ * Each benchmark is an item, which has a name, the input size in bytes,
+ * a reference timing (0 means no reference), and a function to measure.
+ * bench::run() measures all items and prints a table of ns/op and bytes/op.
+ * bytes/op is the number of bytes allocated by operator new in one call.
+ *
+ * Command line options of benchmark binaries are;
+ *     --filter TEXT     run only items whose name includes TEXT.
+ *     --max-ratio R     exit with 1 if (ns/op / reference ns/op) > R
+ *                       in any item which has a reference.
+ */
+
+#ifndef INCLUDE_GUARD_BENCHMARK_BENCHMARK_HPP
+#define INCLUDE_GUARD_BENCHMARK_BENCHMARK_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+/**
+ * @struct  input
+ * @brief   common input data of benchmarks.
+ *          s: text, t: copy of s (not same object), h: first 3 characters
+ *          of s, w: last 3 characters of s, v: s.split().
+ */
+struct input
+{
+    explicit input(std::size_t size);
+
+    std::string s;
+    std::string t;
+    std::string h;
+    std::string w;
+    std::vector<std::string> v;
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct  item
+ * @brief   one benchmark item.
+ */
+struct item
+{
+    const char* name;
+    std::size_t size;
+    double reference_ns;
+    void (*func)(const input&);
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      create a deterministic text. the same text is made by
+ *             make_text() in benchmark creator scripts.
+ * @param[in]  size: size of text in bytes.
+ * @return     created text.
+ */
+std::string make_text(std::size_t size);
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      prevent the compiler from removing a computation.
+ * @param[in]  p: address of the result of computation.
+ */
+void keep(const void* p);
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      run benchmark items and print results.
+ * @param[in]  items: first item.
+ * @param[in]  size: the number of items.
+ * @param[in]  argc: argc of main().
+ * @param[in]  argv: argv of main().
+ * @return     exit code. 0: OK, 1: ratio check failed, 2: wrong arguments.
+ */
+int run(const item* items, std::size_t size, int argc, char* argv[]);
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      run benchmark items and print results.
+ * @tparam     N: the number of items.
+ * @param[in]  items: array of items.
+ * @param[in]  argc: argc of main().
+ * @param[in]  argv: argv of main().
+ * @return     exit code. 0: OK, 1: ratio check failed, 2: wrong arguments.
+ */
+template <std::size_t N>
+int run(const item (&items)[N], int argc, char* argv[])
+{
+    return run(items, N, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace bench {
+
+#endif // #ifndef INCLUDE_GUARD_BENCHMARK_BENCHMARK_HPP
@@ -0,0 +1,191 @@
+/**
+ * @file    benchmark/biconv_benchmark.cpp
+ * @brief   Benchmark of convert() and rconvert() of ken3::biconv.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ * @note    size of each item is the number of registered pairs n. one call
+ *          converts all of n elements by convert() and rconvert().
+ *          "int" items use integral columns. "legacy" items search pairs
+ *          by std::find_if, which was used before columns.
+ *          "loop int" items convert all of n elements by convert() with a
+ *          default, and "batch int" items do the same by convert_many().
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "ken3/biconv.hpp"
+#include "benchmark/benchmark.hpp"
+
+namespace {
+
+using linear_conv = ken3::biconv<int, std::string, ken3::biconv_type::linear>;
+using hashed_conv = ken3::biconv<int, std::string, ken3::biconv_type::hashed>;
+using int_conv = ken3::biconv<int, int>;
+
+/**
+ * @brief      get registered pairs for appointed size.
+ * @param[in]  n: the number of pairs.
+ * @return     pairs of code and its name.
+ */
+const std::vector<std::pair<int, std::string>>& pairs(std::size_t n)
+{
+    static std::map<std::size_t, std::vector<std::pair<int, std::string>>> cache;
+    std::vector<std::pair<int, std::string>>& v = cache[n];
+    if (v.empty()) {
+        for (int i = 0; i < static_cast<int>(n); i++) {
+            v.emplace_back(i * 7, "code" + std::to_string(i));
+        }
+    }
+    return v;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      make pairs of int table.
+ * @param[in]  n: the number of pairs.
+ * @return     pairs of code and its value.
+ */
+std::vector<std::pair<int, int>> int_pairs(std::size_t n)
+{
+    std::vector<std::pair<int, int>> v;
+    for (int i = 0; i < static_cast<int>(n); i++) {
+        v.emplace_back(i * 7, 1000 - i);
+    }
+    return v;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      get biconv for appointed size. it is created at first call.
+ * @param[in]  n: the number of pairs.
+ * @return     biconv
+ */
+template <typename CONV>
+const CONV& get(std::size_t n)
+{
+    static std::map<std::size_t, std::unique_ptr<CONV>> cache;
+    std::unique_ptr<CONV>& c = cache[n];
+    if (!c) {
+        const std::vector<std::pair<int, std::string>>& v = pairs(n);
+        c.reset(new CONV(v.begin(), v.end()));
+    }
+    return *c;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of convert() and rconvert() for all registered pairs.
+ */
+template <typename CONV, std::size_t N>
+void lookup(const bench::input& in)
+{
+    const CONV& c = get<CONV>(N);
+    std::size_t sum = 0;
+    for (const auto& i: pairs(N)) {
+        sum += c.convert(i.first).size() + static_cast<std::size_t>(c.rconvert(i.second));
+    }
+    bench::keep(&sum);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of convert() and rconvert() of int table.
+ */
+template <std::size_t N>
+void lookup_int(const bench::input& in)
+{
+    static const std::vector<std::pair<int, int>> v = int_pairs(N);
+    static const int_conv c(v.begin(), v.end());
+    int sum = 0;
+    for (const auto& i: v) {
+        sum += c.convert(i.first) + c.rconvert(i.second);
+    }
+    bench::keep(&sum);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of searching pairs of int table by std::find_if.
+ */
+template <std::size_t N>
+void legacy_int(const bench::input& in)
+{
+    static const std::vector<std::pair<int, int>> v = int_pairs(N);
+    int sum = 0;
+    for (const auto& i: v) {
+        auto f = std::find_if(v.begin(), v.end(), [&i](const std::pair<int, int>& j) { return j.first == i.first; });
+        auto s = std::find_if(v.begin(), v.end(), [&i](const std::pair<int, int>& j) { return j.second == i.second; });
+        sum += f->second + s->first;
+    }
+    bench::keep(&sum);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of convert() with a default for all elements of int table.
+ */
+template <std::size_t N>
+void loop_int(const bench::input& in)
+{
+    static const std::vector<std::pair<int, int>> v = int_pairs(N);
+    static const int_conv c(v.begin(), v.end());
+    std::vector<int> converted(v.size());
+    for (std::size_t i = 0; i < v.size(); i++) {
+        converted[i] = c.convert(v[i].first, -1);
+    }
+    bench::keep(converted.data());
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of convert_many() for all elements of int table.
+ */
+template <std::size_t N>
+void batch_int(const bench::input& in)
+{
+    static const std::vector<std::pair<int, int>> v = int_pairs(N);
+    static const int_conv c(v.begin(), v.end());
+    static std::vector<int> keys;
+    if (keys.empty()) {
+        for (const auto& i: v) {
+            keys.push_back(i.first);
+        }
+    }
+    std::vector<int> converted(keys.size());
+    c.convert_many(keys.begin(), keys.end(), converted.begin(), -1);
+    bench::keep(converted.data());
+}
+/////////////////////////////////////////////////////////////////////////////
+
+const bench::item items[] =
+{
+    {"lookup linear", 8, 0.0, lookup<linear_conv, 8>},
+    {"lookup hashed", 8, 0.0, lookup<hashed_conv, 8>},
+    {"lookup linear", 64, 0.0, lookup<linear_conv, 64>},
+    {"lookup hashed", 64, 0.0, lookup<hashed_conv, 64>},
+    {"lookup linear", 5000, 0.0, lookup<linear_conv, 5000>},
+    {"lookup hashed", 5000, 0.0, lookup<hashed_conv, 5000>},
+    {"lookup int", 8, 0.0, lookup_int<8>},
+    {"legacy int", 8, 0.0, legacy_int<8>},
+    {"lookup int", 64, 0.0, lookup_int<64>},
+    {"legacy int", 64, 0.0, legacy_int<64>},
+    {"loop int", 1000, 0.0, loop_int<1000>},
+    {"batch int", 1000, 0.0, batch_int<1000>},
+    {"loop int", 5000, 0.0, loop_int<5000>},
+    {"batch int", 5000, 0.0, batch_int<5000>},
+};
+
+} // namespace {
+
+int main(int argc, char* argv[])
+{
+    return bench::run(items, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
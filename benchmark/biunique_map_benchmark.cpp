@@ -0,0 +1,274 @@
+/**
+ * @file    benchmark/biunique_map_benchmark.cpp
+ * @brief   Benchmark of bulk insert and lookup of ken3::biunique_map.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ * @note    size of each item is the number of inserted pairs k. the map
+ *          has 10 * k pairs before inserting. "legacy" items check
+ *          duplicates by the pairwise loops which were used before.
+ *          "lookup" items call f2s() and s2f() for all of 10 * k pairs.
+ *          "lookup frozen" uses frozen_biunique_map, which has the same pairs.
+ *          "loop" items call f2s() for all of 10 * k keys in random order,
+ *          and "batch" items convert the same keys by f2s_many().
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "ken3/biunique_map.hpp"
+#include "ken3/biunique_map/frozen.hpp"
+#include "benchmark/benchmark.hpp"
+
+namespace {
+
+using ordered_map = ken3::biunique_map<int, int, ken3::biunique_map_type::ordered_no_default, ken3::biunique_map_policy::throwing>;
+using unordered_map = ken3::biunique_map<int, int, ken3::biunique_map_type::unordered_no_default, ken3::biunique_map_policy::throwing>;
+using flat_map = ken3::biunique_map<int, int, ken3::biunique_map_type::flat_no_default, ken3::biunique_map_policy::throwing>;
+
+/**
+ * @struct  data
+ * @brief   registered map and inserted pairs.
+ */
+template <typename MAP>
+struct data
+{
+    MAP base;
+    std::vector<std::pair<const int, int>> pairs;
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      get data for appointed size. data are created at first call.
+ * @param[in]  k: the number of inserted pairs.
+ * @return     data
+ */
+template <typename MAP>
+const data<MAP>& get(std::size_t k)
+{
+    static std::map<std::size_t, std::unique_ptr<data<MAP>>> cache;
+    std::unique_ptr<data<MAP>>& d = cache[k];
+    if (!d) {
+        d.reset(new data<MAP>());
+        int n = static_cast<int>(k * 10);
+        std::vector<std::pair<const int, int>> registered;
+        for (int i = 0; i < n; i++) {
+            registered.emplace_back(i * 2, i * 3);
+        }
+        d->base.insert(registered.begin(), registered.end());
+        for (int i = 0; i < static_cast<int>(k); i++) {
+            d->pairs.emplace_back(i * 2 + 1, i * 3 + 1);
+        }
+    }
+    return *d;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      bulk insert with the pairwise check, which was used before.
+ * @param[in,out] m: destination.
+ * @param[in]  first: first iterator
+ * @param[in]  last: last iterator
+ */
+template <typename MAP, typename InputIt>
+void legacy_insert(MAP& m, InputIt first, InputIt last)
+{
+    for (auto i = first; i != last; ++i) {
+        for (auto j = std::next(i, 1); j != last; ++j) {
+            if ((i->first == j->first) || (i->second == j->second)) {
+                throw std::invalid_argument("");
+            }
+        }
+    }
+    for (auto i = m.cbegin(); i != m.cend(); ++i) {
+        for (auto j = first; j != last; ++j) {
+            if ((i->first == j->first) || (i->second == j->second)) {
+                throw std::invalid_argument("");
+            }
+        }
+    }
+    m.insert(first, last);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of copying registered map, which is a part of others.
+ */
+template <typename MAP, std::size_t K>
+void copy_only(const bench::input& in)
+{
+    MAP m(get<MAP>(K).base);
+    bench::keep(&m);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of bulk insert.
+ */
+template <typename MAP, std::size_t K>
+void insert(const bench::input& in)
+{
+    const data<MAP>& d = get<MAP>(K);
+    MAP m(d.base);
+    m.insert(d.pairs.begin(), d.pairs.end());
+    bench::keep(&m);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of bulk insert with the pairwise check.
+ */
+template <typename MAP, std::size_t K>
+void legacy(const bench::input& in)
+{
+    const data<MAP>& d = get<MAP>(K);
+    MAP m(d.base);
+    legacy_insert(m, d.pairs.begin(), d.pairs.end());
+    bench::keep(&m);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of f2s() and s2f() for all registered pairs.
+ */
+template <typename MAP, std::size_t K>
+void lookup(const bench::input& in)
+{
+    const MAP& m = get<MAP>(K).base;
+    int sum = 0;
+    for (int i = 0; i < static_cast<int>(K * 10); i++) {
+        sum += m.f2s(i * 2) + m.s2f(i * 3);
+    }
+    bench::keep(&sum);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of f2s() and s2f() of frozen_biunique_map.
+ */
+template <std::size_t K>
+void lookup_frozen(const bench::input& in)
+{
+    using frozen_map = ken3::frozen_biunique_map<int, int>;
+    const ordered_map& base = get<ordered_map>(K).base;
+    static const frozen_map m(base.cbegin(), base.cend());
+    int sum = 0;
+    for (int i = 0; i < static_cast<int>(K * 10); i++) {
+        sum += m.f2s(i * 2) + m.s2f(i * 3);
+    }
+    bench::keep(&sum);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      get keys of registered pairs in random order.
+ * @param[in]  k: the number of inserted pairs. keys are 10 * k.
+ * @return     keys
+ */
+const std::vector<int>& shuffled(std::size_t k)
+{
+    static std::map<std::size_t, std::vector<int>> cache;
+    std::vector<int>& v = cache[k];
+    if (v.empty()) {
+        std::uint32_t seed = 2463534242U;
+        for (int i = 0; i < static_cast<int>(k * 10); i++) {
+            v.push_back(i * 2);
+        }
+        for (std::size_t i = v.size() - 1; i > 0; i--) {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            std::swap(v[i], v[seed % (i + 1)]);
+        }
+    }
+    return v;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of f2s() for keys in random order.
+ */
+template <typename MAP, std::size_t K>
+void loop(const bench::input& in)
+{
+    const MAP& m = get<MAP>(K).base;
+    const std::vector<int>& keys = shuffled(K);
+    std::vector<int> converted(keys.size());
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        converted[i] = m.f2s(keys[i]);
+    }
+    bench::keep(converted.data());
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of f2s_many() for keys in random order.
+ */
+template <typename MAP, std::size_t K>
+void batch(const bench::input& in)
+{
+    const MAP& m = get<MAP>(K).base;
+    const std::vector<int>& keys = shuffled(K);
+    std::vector<int> converted(keys.size());
+    m.f2s_many(keys.begin(), keys.end(), converted.begin());
+    bench::keep(converted.data());
+}
+/////////////////////////////////////////////////////////////////////////////
+
+const bench::item items[] =
+{
+    {"copy ordered", 100, 0.0, copy_only<ordered_map, 100>},
+    {"insert ordered", 100, 0.0, insert<ordered_map, 100>},
+    {"legacy ordered", 100, 0.0, legacy<ordered_map, 100>},
+    {"copy ordered", 1000, 0.0, copy_only<ordered_map, 1000>},
+    {"insert ordered", 1000, 0.0, insert<ordered_map, 1000>},
+    {"legacy ordered", 1000, 0.0, legacy<ordered_map, 1000>},
+    {"copy ordered", 100000, 0.0, copy_only<ordered_map, 100000>},
+    {"insert ordered", 100000, 0.0, insert<ordered_map, 100000>},
+    {"copy unordered", 100, 0.0, copy_only<unordered_map, 100>},
+    {"insert unordered", 100, 0.0, insert<unordered_map, 100>},
+    {"legacy unordered", 100, 0.0, legacy<unordered_map, 100>},
+    {"copy unordered", 1000, 0.0, copy_only<unordered_map, 1000>},
+    {"insert unordered", 1000, 0.0, insert<unordered_map, 1000>},
+    {"legacy unordered", 1000, 0.0, legacy<unordered_map, 1000>},
+    {"copy unordered", 100000, 0.0, copy_only<unordered_map, 100000>},
+    {"insert unordered", 100000, 0.0, insert<unordered_map, 100000>},
+    {"copy flat", 100, 0.0, copy_only<flat_map, 100>},
+    {"insert flat", 100, 0.0, insert<flat_map, 100>},
+    {"legacy flat", 100, 0.0, legacy<flat_map, 100>},
+    {"copy flat", 1000, 0.0, copy_only<flat_map, 1000>},
+    {"insert flat", 1000, 0.0, insert<flat_map, 1000>},
+    {"legacy flat", 1000, 0.0, legacy<flat_map, 1000>},
+    {"copy flat", 100000, 0.0, copy_only<flat_map, 100000>},
+    {"insert flat", 100000, 0.0, insert<flat_map, 100000>},
+    {"lookup ordered", 1000, 0.0, lookup<ordered_map, 1000>},
+    {"lookup unordered", 1000, 0.0, lookup<unordered_map, 1000>},
+    {"lookup flat", 1000, 0.0, lookup<flat_map, 1000>},
+    {"lookup frozen", 1000, 0.0, lookup_frozen<1000>},
+    {"lookup ordered", 100000, 0.0, lookup<ordered_map, 100000>},
+    {"lookup unordered", 100000, 0.0, lookup<unordered_map, 100000>},
+    {"lookup flat", 100000, 0.0, lookup<flat_map, 100000>},
+    {"lookup frozen", 100000, 0.0, lookup_frozen<100000>},
+    {"loop ordered", 1000, 0.0, loop<ordered_map, 1000>},
+    {"batch ordered", 1000, 0.0, batch<ordered_map, 1000>},
+    {"loop flat", 1000, 0.0, loop<flat_map, 1000>},
+    {"batch flat", 1000, 0.0, batch<flat_map, 1000>},
+    {"loop ordered", 100000, 0.0, loop<ordered_map, 100000>},
+    {"batch ordered", 100000, 0.0, batch<ordered_map, 100000>},
+    {"loop flat", 100000, 0.0, loop<flat_map, 100000>},
+    {"batch flat", 100000, 0.0, batch<flat_map, 100000>},
+};
+
+} // namespace {
+
+int main(int argc, char* argv[])
+{
+    return bench::run(items, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
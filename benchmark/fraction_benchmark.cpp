@@ -0,0 +1,480 @@
+/**
+ * @file    benchmark/fraction_benchmark.cpp
+ * @brief   Benchmark of reduction, comparison and arithmetic of ken3::fraction.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ * @note    size of each item is the bit width of numerators and denominators.
+ *          one call reduces or sorts 1000 pairs which have a common factor.
+ *          "legacy reduce" reduces the same pairs by Euclid's algorithm,
+ *          which was used by fraction before binary gcd. "legacy sort"
+ *          compares fractions by integer and decimal parts, which was used
+ *          by fraction before cross multiplication. "wide harmonic" is
+ *          calculated by basic_fraction<wide_int<128>>, whose results
+ *          exceed 64 bits. "accumulate" sums N prices, whose denominators
+ *          are 10, 100 or 1000, by ken3::fraction_accumulator. "eager
+ *          accumulate" sums them by operator+= of ken3::fraction.
+ *          "array scale" and "array add" calculate a[i] * k and a[i] + b[i]
+ *          by ken3::fraction_array, and "scale" and "add" calculate them by
+ *          operators of ken3::fraction for each element. "try add"
+ *          calculates a[i] + b[i] by try_add(), which reports overflow by
+ *          an error code instead of an exception. most of sums overflow in
+ *          size 62.
+ *          "from_double" converts 1000 doubles to exact fractions, and
+ *          "from_double limit" finds the closest fraction whose denominator
+ *          is <= size by continued fractions. "stern-brocot" finds the same
+ *          one by walking the Stern-Brocot tree.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "ken3/fraction.hpp"
+#include "ken3/fraction/accumulator.hpp"
+#include "ken3/fraction/array.hpp"
+#include "ken3/fraction/wide_int.hpp"
+#include "benchmark/benchmark.hpp"
+
+namespace {
+
+using int_type = ken3::fraction::int_type;
+
+/**
+ * @brief      get pairs of numerator and denominator for appointed bit width.
+ * @param[in]  bits: bit width of each value.
+ * @return     pairs which have a common factor.
+ */
+const std::vector<std::pair<int_type, int_type>>& pairs(std::size_t bits)
+{
+    static std::map<std::size_t, std::vector<std::pair<int_type, int_type>>> cache;
+    std::vector<std::pair<int_type, int_type>>& v = cache[bits];
+    if (v.empty()) {
+        std::uint64_t seed = 88172645463325252ULL;
+        auto next = [&seed](std::size_t width) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            return static_cast<int_type>(seed >> (64 - width)) + 1;
+        };
+        for (int i = 0; i < 1000; i++) {
+            int_type common = next(10);
+            int_type numerator = next(bits - 10) * common;
+            int_type denominator = next(bits - 10) * common;
+            v.emplace_back((i % 2 == 0) ? numerator : -numerator, denominator);
+        }
+    }
+    return v;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      gcd by Euclid's algorithm, which was used before binary gcd.
+ * @param[in]  x: lhs. should be > 0
+ * @param[in]  y: rhs. should be > 0
+ * @return     calculated gcd.
+ */
+int_type euclid_gcd(int_type x, int_type y) noexcept
+{
+    while (y != 0) {
+        int_type tmp = y;
+        y = x % y;
+        x = tmp;
+    }
+    return x;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      operator< of fraction, which was used before cross multiplication.
+ * @param[in]  lhs: left hand side of operator<
+ * @param[in]  rhs: right hand side of operator<
+ * @return     result of operator<
+ */
+bool legacy_less(const ken3::fraction& lhs, const ken3::fraction& rhs)
+{
+    using limit = std::numeric_limits<int_type>;
+
+    if ((lhs.numerator() == 0) || (rhs.numerator() == 0)) {
+        return (lhs.numerator() < rhs.numerator());
+    }
+    else if ((rhs.numerator() == limit::min()) && (rhs.denominator() == 1)) {
+        return false;
+    }
+    else if ((lhs.numerator() == limit::min()) && (lhs.denominator() == 1)) {
+        return true;
+    }
+    else if ((lhs.numerator() > 0) != (rhs.numerator() > 0)) {
+        return (lhs.numerator() < 0);
+    }
+    int_type int_lhs = lhs.numerator() / lhs.denominator();
+    int_type int_rhs = rhs.numerator() / rhs.denominator();
+    if (int_lhs != int_rhs) {
+        return (int_lhs < int_rhs);
+    }
+    int_type deci_lhs = lhs.numerator() % lhs.denominator();
+    int_type deci_rhs = rhs.numerator() % rhs.denominator();
+    if ((deci_lhs == 0) || (deci_rhs == 0)) {
+        return (deci_lhs < deci_rhs);
+    }
+    return legacy_less(ken3::fraction(rhs.denominator(), deci_rhs), ken3::fraction(lhs.denominator(), deci_lhs));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      get fractions for appointed bit width.
+ * @param[in]  bits: bit width of each value.
+ * @return     reduced fractions.
+ */
+const std::vector<ken3::fraction>& fractions(std::size_t bits)
+{
+    static std::map<std::size_t, std::vector<ken3::fraction>> cache;
+    std::vector<ken3::fraction>& v = cache[bits];
+    if (v.empty()) {
+        for (const auto& i: pairs(bits)) {
+            v.emplace_back(i.first, i.second);
+        }
+    }
+    return v;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of reduction by constructor of fraction.
+ */
+template <std::size_t BITS>
+void reduce(const bench::input& in)
+{
+    int_type sum = 0;
+    for (const auto& i: pairs(BITS)) {
+        ken3::fraction f(i.first, i.second);
+        sum += f.numerator() + f.denominator();
+    }
+    bench::keep(&sum);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of reduction by Euclid's algorithm.
+ */
+template <std::size_t BITS>
+void legacy_reduce(const bench::input& in)
+{
+    int_type sum = 0;
+    for (const auto& i: pairs(BITS)) {
+        int_type g = euclid_gcd(std::abs(i.first), i.second);
+        sum += i.first / g + i.second / g;
+    }
+    bench::keep(&sum);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of std::sort by operator<.
+ */
+template <std::size_t BITS>
+void sort(const bench::input& in)
+{
+    std::vector<ken3::fraction> v = fractions(BITS);
+    std::sort(v.begin(), v.end());
+    bench::keep(v.data());
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of std::sort by the former operator<.
+ */
+template <std::size_t BITS>
+void legacy_sort(const bench::input& in)
+{
+    std::vector<ken3::fraction> v = fractions(BITS);
+    std::sort(v.begin(), v.end(), legacy_less);
+    bench::keep(v.data());
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of arithmetic. 1/1 + 1/2 + ... + 1/N, then
+ *             multiplied and divided by each term.
+ */
+template <std::size_t N, typename F = ken3::fraction>
+void harmonic(const bench::input& in)
+{
+    F sum(0, 1);
+    for (int_type i = 1; i <= static_cast<int_type>(N); i++) {
+        sum += F(1, i);
+    }
+    for (int_type i = 1; i <= static_cast<int_type>(N); i++) {
+        sum *= F(i + 1, i);
+        sum /= F(i + 1, i);
+    }
+    bench::keep(&sum);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      get prices, whose denominators are 10, 100 or 1000.
+ * @return     fractions
+ */
+const std::vector<ken3::fraction>& prices(void)
+{
+    static std::vector<ken3::fraction> v;
+    if (v.empty()) {
+        const int_type denominators[] = {10, 100, 1000};
+        for (const auto& i: pairs(16)) {
+            v.emplace_back(i.first % 100000, denominators[i.second % 3]);
+        }
+    }
+    return v;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of sum by accumulator F.
+ */
+template <std::size_t N, typename F>
+void accumulate(const bench::input& in)
+{
+    F sum;
+    for (std::size_t i = 0; i < N; i++) {
+        sum += prices()[i % prices().size()];
+    }
+    ken3::fraction result = sum;
+    bench::keep(&result);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of a[i] * k by operator*.
+ */
+template <std::size_t BITS>
+void scale(const bench::input& in)
+{
+    const ken3::fraction k(3, 7);
+    std::vector<ken3::fraction> v = fractions(BITS);
+    for (auto& i: v) {
+        try {
+            i = i * k;
+        }
+        catch (const std::overflow_error&) {
+        }
+    }
+    bench::keep(v.data());
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of a[i] * k by fraction_array.
+ */
+template <std::size_t BITS>
+void array_scale(const bench::input& in)
+{
+    static const ken3::fraction_array src(fractions(BITS).begin(), fractions(BITS).end());
+    const ken3::fraction k(3, 7);
+    ken3::fraction_array a = src;
+    ken3::fraction_array::mask_type overflow = a.multiply(k);
+    bench::keep(overflow.data());
+    bench::keep(a.numerators());
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of a[i] + b[i] by operator+.
+ */
+template <std::size_t BITS>
+void add(const bench::input& in)
+{
+    const std::vector<ken3::fraction>& rhs = fractions(BITS);
+    std::vector<ken3::fraction> v(rhs.rbegin(), rhs.rend());
+    for (std::size_t i = 0; i < v.size(); i++) {
+        try {
+            v[i] = v[i] + rhs[i];
+        }
+        catch (const std::overflow_error&) {
+        }
+    }
+    bench::keep(v.data());
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of a[i] + b[i] by fraction_array.
+ */
+template <std::size_t BITS>
+void array_add(const bench::input& in)
+{
+    static const ken3::fraction_array rhs(fractions(BITS).begin(), fractions(BITS).end());
+    static const ken3::fraction_array src(fractions(BITS).rbegin(), fractions(BITS).rend());
+    ken3::fraction_array a = src;
+    ken3::fraction_array::mask_type overflow = a.add(rhs);
+    bench::keep(overflow.data());
+    bench::keep(a.numerators());
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of a[i] + b[i] by try_add(), which returns an error code.
+ */
+template <std::size_t BITS>
+void try_add(const bench::input& in)
+{
+    const std::vector<ken3::fraction>& rhs = fractions(BITS);
+    std::vector<ken3::fraction> v(rhs.rbegin(), rhs.rend());
+    std::size_t overflow = 0;
+    for (std::size_t i = 0; i < v.size(); i++) {
+        overflow += (v[i].try_add(rhs[i]) != ken3::fraction_errc::ok) ? 1 : 0;
+    }
+    bench::keep(&overflow);
+    bench::keep(v.data());
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      get doubles, which are ratios of pairs.
+ * @param[in]  exact: true: only values which ken3::fraction represents exactly.
+ * @return     doubles
+ */
+const std::vector<double>& doubles(bool exact)
+{
+    static std::map<bool, std::vector<double>> cache;
+    std::vector<double>& v = cache[exact];
+    if (v.empty()) {
+        for (const auto& i: pairs(32)) {
+            const double x = static_cast<double>(i.first) / static_cast<double>(i.second);
+            try {
+                if (exact) {
+                    ken3::fraction::from_double(x);
+                }
+                v.push_back(x);
+            }
+            catch (const std::overflow_error&) {
+            }
+        }
+    }
+    return v;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      find the closest fraction by walking the Stern-Brocot tree,
+ *             which is linear to the sum of partial quotients.
+ * @param[in]  x: value
+ * @param[in]  max_denominator: maximum denominator (>= 1)
+ * @return     the closest fraction
+ */
+ken3::fraction stern_brocot(double x, int_type max_denominator)
+{
+    const double integer = std::floor(x);
+    const double decimal = x - integer;
+    int_type ln = 0, ld = 1, rn = 1, rd = 1;
+    for (;;) {
+        const int_type mn = ln + rn;
+        const int_type md = ld + rd;
+        if (md > max_denominator) {
+            break;
+        }
+        if (static_cast<double>(mn) > decimal * static_cast<double>(md)) {
+            rn = mn;
+            rd = md;
+        }
+        else if (static_cast<double>(mn) < decimal * static_cast<double>(md)) {
+            ln = mn;
+            ld = md;
+        }
+        else {
+            ln = rn = mn;
+            ld = rd = md;
+            break;
+        }
+    }
+    const bool left = (decimal - static_cast<double>(ln) / ld) <= (static_cast<double>(rn) / rd - decimal);
+    return ken3::fraction(static_cast<int_type>(integer), 1) + (left ? ken3::fraction(ln, ld) : ken3::fraction(rn, rd));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of exact conversion from double.
+ */
+void from_double(const bench::input& in)
+{
+    int_type sum = 0;
+    for (const auto& i: doubles(true)) {
+        sum += ken3::fraction::from_double(i).denominator();
+    }
+    bench::keep(&sum);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of conversion from double with limited denominator.
+ */
+template <std::size_t MAX>
+void from_double_limit(const bench::input& in)
+{
+    int_type sum = 0;
+    for (const auto& i: doubles(false)) {
+        sum += ken3::fraction::from_double(i, MAX).denominator();
+    }
+    bench::keep(&sum);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of Stern-Brocot walk with limited denominator.
+ */
+template <std::size_t MAX>
+void stern_brocot(const bench::input& in)
+{
+    int_type sum = 0;
+    for (const auto& i: doubles(false)) {
+        sum += stern_brocot(i, MAX).denominator();
+    }
+    bench::keep(&sum);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+const bench::item items[] =
+{
+    {"reduce", 16, 0.0, reduce<16>},
+    {"legacy reduce", 16, 0.0, legacy_reduce<16>},
+    {"reduce", 32, 0.0, reduce<32>},
+    {"legacy reduce", 32, 0.0, legacy_reduce<32>},
+    {"reduce", 62, 0.0, reduce<62>},
+    {"legacy reduce", 62, 0.0, legacy_reduce<62>},
+    {"sort", 32, 0.0, sort<32>},
+    {"legacy sort", 32, 0.0, legacy_sort<32>},
+    {"sort", 62, 0.0, sort<62>},
+    {"legacy sort", 62, 0.0, legacy_sort<62>},
+    {"harmonic", 30, 0.0, harmonic<30>},
+    {"wide harmonic", 30, 0.0, harmonic<30, ken3::basic_fraction<ken3::wide_int<128>>>},
+    {"wide harmonic", 60, 0.0, harmonic<60, ken3::basic_fraction<ken3::wide_int<128>>>},
+    {"accumulate", 1000, 0.0, accumulate<1000, ken3::fraction_accumulator>},
+    {"eager accumulate", 1000, 0.0, accumulate<1000, ken3::fraction>},
+    {"array scale", 32, 0.0, array_scale<32>},
+    {"scale", 32, 0.0, scale<32>},
+    {"array add", 32, 0.0, array_add<32>},
+    {"add", 32, 0.0, add<32>},
+    {"try add", 32, 0.0, try_add<32>},
+    {"add", 62, 0.0, add<62>},
+    {"try add", 62, 0.0, try_add<62>},
+    {"from_double", 53, 0.0, from_double},
+    {"from_double limit", 1000, 0.0, from_double_limit<1000>},
+    {"stern-brocot", 1000, 0.0, stern_brocot<1000>},
+    {"from_double limit", 1000000, 0.0, from_double_limit<1000000>},
+    {"stern-brocot", 1000000, 0.0, stern_brocot<1000000>},
+};
+
+} // namespace {
+
+int main(int argc, char* argv[])
+{
+    return bench::run(items, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
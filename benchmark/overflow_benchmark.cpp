@@ -0,0 +1,195 @@
+/**
+ * @file    benchmark/overflow_benchmark.cpp
+ * @brief   Benchmark of overflow checks of ken3::overflow.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ * @note    size of each item is the bit width of prices and quantities.
+ *          one call sums price * quantity of 1000 pairs, and skips the
+ *          pairs which make overflow. "occur" checks by occur_mul() and
+ *          occur_add() before the calculation, "portable occur" checks by
+ *          the portable code with divisions, and "checked" calculates and
+ *          checks at once by checked_mul() and checked_add().
+ *          "branch add" adds 1000 samples of size bits to an accumulator
+ *          array 4 times, and clamps each overflowing element after
+ *          occur_add().
+ *          "saturating add" does the same by batch saturating_add(), which
+ *          uses SSE2 for 16 bits samples.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+#include "ken3/overflow.hpp"
+#include "benchmark/benchmark.hpp"
+
+namespace {
+
+/**
+ * @brief      get pairs of price and quantity for appointed bit width.
+ * @param[in]  bits: bit width of each value.
+ * @return     pairs of signed values.
+ */
+const std::vector<std::pair<std::int64_t, std::int64_t>>& pairs(std::size_t bits)
+{
+    static std::map<std::size_t, std::vector<std::pair<std::int64_t, std::int64_t>>> cache;
+    std::vector<std::pair<std::int64_t, std::int64_t>>& v = cache[bits];
+    if (v.empty()) {
+        std::uint64_t seed = 88172645463325252ULL;
+        auto next = [&seed, bits]() {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            const std::int64_t x = static_cast<std::int64_t>(seed >> (65 - bits));
+            return (seed & 1) ? -x : x;
+        };
+        for (int i = 0; i < 1000; i++) {
+            const std::int64_t price = next();
+            v.emplace_back(price, next());
+        }
+    }
+    return v;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of sum by occur_mul() and occur_add().
+ */
+template <std::size_t BITS>
+void occur(const bench::input& in)
+{
+    using namespace ken3::overflow;
+
+    std::int64_t total = 0;
+    for (const auto& i: pairs(BITS)) {
+        if (not occur_mul(i.first, i.second) && not occur_add(total, std::int64_t(i.first * i.second))) {
+            total += i.first * i.second;
+        }
+    }
+    bench::keep(&total);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of sum by the portable occur_mul() and occur_add().
+ */
+template <std::size_t BITS>
+void portable_occur(const bench::input& in)
+{
+    using namespace ken3::overflow::overflow_detail;
+
+    std::int64_t total = 0;
+    for (const auto& i: pairs(BITS)) {
+        if (not occur_mul(i.first, i.second) && not occur_add(total, std::int64_t(i.first * i.second))) {
+            total += i.first * i.second;
+        }
+    }
+    bench::keep(&total);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of sum by checked_mul() and checked_add().
+ */
+template <std::size_t BITS>
+void checked(const bench::input& in)
+{
+    using namespace ken3::overflow;
+
+    std::int64_t total = 0;
+    for (const auto& i: pairs(BITS)) {
+        std::int64_t product = 0;
+        std::int64_t sum = 0;
+        if (not checked_mul(i.first, i.second, product) && not checked_add(total, product, sum)) {
+            total = sum;
+        }
+    }
+    bench::keep(&total);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      get samples of integer type T.
+ * @return     1000 samples, which are upper bits of prices.
+ */
+template <typename T>
+const std::vector<T>& samples(void)
+{
+    static std::vector<T> v;
+    if (v.empty()) {
+        for (const auto& i: pairs(62)) {
+            v.push_back(static_cast<T>(i.first >> (62 - 8 * sizeof(T))));
+        }
+    }
+    return v;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of accumulation by occur_add() and branches.
+ */
+template <typename T>
+void branch_add(const bench::input& in)
+{
+    using limit = std::numeric_limits<T>;
+
+    std::vector<T> acc(samples<T>().size(), limit::max() / 2);
+    for (int n = 0; n < 4; n++) {
+        for (std::size_t i = 0; i < acc.size(); i++) {
+            const T x = samples<T>()[i];
+            if (not ken3::overflow::occur_add(acc[i], x)) {
+                acc[i] = acc[i] + x;
+            }
+            else if (x > 0) {
+                acc[i] = limit::max();
+            }
+            else {
+                acc[i] = limit::min();
+            }
+        }
+    }
+    bench::keep(acc.data());
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      benchmark of accumulation by batch saturating_add().
+ */
+template <typename T>
+void saturating_add(const bench::input& in)
+{
+    using limit = std::numeric_limits<T>;
+
+    std::vector<T> acc(samples<T>().size(), limit::max() / 2);
+    for (int n = 0; n < 4; n++) {
+        ken3::overflow::saturating_add(acc.data(), samples<T>().data(), acc.data(), acc.size());
+    }
+    bench::keep(acc.data());
+}
+/////////////////////////////////////////////////////////////////////////////
+
+const bench::item items[] =
+{
+    {"occur", 20, 0.0, occur<20>},
+    {"portable occur", 20, 0.0, portable_occur<20>},
+    {"checked", 20, 0.0, checked<20>},
+    {"occur", 40, 0.0, occur<40>},
+    {"portable occur", 40, 0.0, portable_occur<40>},
+    {"checked", 40, 0.0, checked<40>},
+    {"branch add", 16, 0.0, branch_add<std::int16_t>},
+    {"saturating add", 16, 0.0, saturating_add<std::int16_t>},
+    {"branch add", 32, 0.0, branch_add<std::int32_t>},
+    {"saturating add", 32, 0.0, saturating_add<std::int32_t>},
+};
+
+} // namespace {
+
+int main(int argc, char* argv[])
+{
+    return bench::run(items, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
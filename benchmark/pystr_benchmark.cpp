@@ -0,0 +1,195 @@
+/**
+ * @file    benchmark/pystr_benchmark.cpp
+ * @brief   Benchmark of ken3::pystr with CPython reference timings.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ * @note    This file is created by Python to get CPython reference timings.
+ *          Please, do not modify this file by manual.
+ *          The reference timings are measured by CPython 3.11.7 on x86_64.
+ */
+
+#include "ken3/pystr.hpp"
+#include "benchmark/benchmark.hpp"
+
+namespace {
+
+using namespace ken3::pystr;
+
+const bench::item items[] =
+{
+    {"add()", 16, 68.1, [](const bench::input& in) { auto r = add(in.s, in.t); bench::keep(&r); }},
+    {"add()", 1024, 141.9, [](const bench::input& in) { auto r = add(in.s, in.t); bench::keep(&r); }},
+    {"add()", 1048576, 194384.6, [](const bench::input& in) { auto r = add(in.s, in.t); bench::keep(&r); }},
+    {"contains()", 16, 45.3, [](const bench::input& in) { auto r = contains(in.s, "vow?"); bench::keep(&r); }},
+    {"contains()", 1024, 919.2, [](const bench::input& in) { auto r = contains(in.s, "vow?"); bench::keep(&r); }},
+    {"contains()", 1048576, 930173.2, [](const bench::input& in) { auto r = contains(in.s, "vow?"); bench::keep(&r); }},
+    {"eq()", 16, 39.9, [](const bench::input& in) { auto r = eq(in.s, in.t); bench::keep(&r); }},
+    {"eq()", 1024, 62.5, [](const bench::input& in) { auto r = eq(in.s, in.t); bench::keep(&r); }},
+    {"eq()", 1048576, 57254.4, [](const bench::input& in) { auto r = eq(in.s, in.t); bench::keep(&r); }},
+    {"ge()", 16, 32.9, [](const bench::input& in) { auto r = ge(in.s, in.t); bench::keep(&r); }},
+    {"ge()", 1024, 42.9, [](const bench::input& in) { auto r = ge(in.s, in.t); bench::keep(&r); }},
+    {"ge()", 1048576, 50501.9, [](const bench::input& in) { auto r = ge(in.s, in.t); bench::keep(&r); }},
+    {"getitem()", 16, 61.9, [](const bench::input& in) { auto r = getitem(in.s, len(in.s) / 2); bench::keep(&r); }},
+    {"getitem()", 1024, 76.7, [](const bench::input& in) { auto r = getitem(in.s, len(in.s) / 2); bench::keep(&r); }},
+    {"getitem()", 1048576, 77.4, [](const bench::input& in) { auto r = getitem(in.s, len(in.s) / 2); bench::keep(&r); }},
+    {"slice()", 16, 98.6, [](const bench::input& in) { auto r = slice(in.s, 1, -1, 2); bench::keep(&r); }},
+    {"slice()", 1024, 361.7, [](const bench::input& in) { auto r = slice(in.s, 1, -1, 2); bench::keep(&r); }},
+    {"slice()", 1048576, 302710.4, [](const bench::input& in) { auto r = slice(in.s, 1, -1, 2); bench::keep(&r); }},
+    {"gt()", 16, 32.3, [](const bench::input& in) { auto r = gt(in.s, in.t); bench::keep(&r); }},
+    {"gt()", 1024, 43.6, [](const bench::input& in) { auto r = gt(in.s, in.t); bench::keep(&r); }},
+    {"gt()", 1048576, 50673.0, [](const bench::input& in) { auto r = gt(in.s, in.t); bench::keep(&r); }},
+    {"le()", 16, 35.5, [](const bench::input& in) { auto r = le(in.s, in.t); bench::keep(&r); }},
+    {"le()", 1024, 46.6, [](const bench::input& in) { auto r = le(in.s, in.t); bench::keep(&r); }},
+    {"le()", 1048576, 56934.5, [](const bench::input& in) { auto r = le(in.s, in.t); bench::keep(&r); }},
+    {"len()", 16, 23.6, [](const bench::input& in) { auto r = len(in.s); bench::keep(&r); }},
+    {"len()", 1024, 47.3, [](const bench::input& in) { auto r = len(in.s); bench::keep(&r); }},
+    {"len()", 1048576, 45.2, [](const bench::input& in) { auto r = len(in.s); bench::keep(&r); }},
+    {"lt()", 16, 37.6, [](const bench::input& in) { auto r = lt(in.s, in.t); bench::keep(&r); }},
+    {"lt()", 1024, 58.7, [](const bench::input& in) { auto r = lt(in.s, in.t); bench::keep(&r); }},
+    {"lt()", 1048576, 55902.6, [](const bench::input& in) { auto r = lt(in.s, in.t); bench::keep(&r); }},
+    {"mul()", 16, 77.9, [](const bench::input& in) { auto r = mul(in.s, 3); bench::keep(&r); }},
+    {"mul()", 1024, 203.8, [](const bench::input& in) { auto r = mul(in.s, 3); bench::keep(&r); }},
+    {"mul()", 1048576, 234743.9, [](const bench::input& in) { auto r = mul(in.s, 3); bench::keep(&r); }},
+    {"ne()", 16, 39.2, [](const bench::input& in) { auto r = ne(in.s, in.t); bench::keep(&r); }},
+    {"ne()", 1024, 46.5, [](const bench::input& in) { auto r = ne(in.s, in.t); bench::keep(&r); }},
+    {"ne()", 1048576, 59347.9, [](const bench::input& in) { auto r = ne(in.s, in.t); bench::keep(&r); }},
+    {"repr()", 16, 112.6, [](const bench::input& in) { auto r = repr(in.s); bench::keep(&r); }},
+    {"repr()", 1024, 6877.8, [](const bench::input& in) { auto r = repr(in.s); bench::keep(&r); }},
+    {"repr()", 1048576, 5878827.3, [](const bench::input& in) { auto r = repr(in.s); bench::keep(&r); }},
+    {"rmul()", 16, 69.8, [](const bench::input& in) { auto r = rmul(in.s, 3); bench::keep(&r); }},
+    {"rmul()", 1024, 160.0, [](const bench::input& in) { auto r = rmul(in.s, 3); bench::keep(&r); }},
+    {"rmul()", 1048576, 209414.2, [](const bench::input& in) { auto r = rmul(in.s, 3); bench::keep(&r); }},
+    {"capitalize()", 16, 152.2, [](const bench::input& in) { auto r = capitalize(in.s); bench::keep(&r); }},
+    {"capitalize()", 1024, 4736.2, [](const bench::input& in) { auto r = capitalize(in.s); bench::keep(&r); }},
+    {"capitalize()", 1048576, 6482959.5, [](const bench::input& in) { auto r = capitalize(in.s); bench::keep(&r); }},
+    {"casefold()", 16, 54.0, [](const bench::input& in) { auto r = casefold(in.s); bench::keep(&r); }},
+    {"casefold()", 1024, 914.9, [](const bench::input& in) { auto r = casefold(in.s); bench::keep(&r); }},
+    {"casefold()", 1048576, 529408.8, [](const bench::input& in) { auto r = casefold(in.s); bench::keep(&r); }},
+    {"center()", 16, 110.5, [](const bench::input& in) { auto r = center(in.s, len(in.s) + 11, "*"); bench::keep(&r); }},
+    {"center()", 1024, 300.1, [](const bench::input& in) { auto r = center(in.s, len(in.s) + 11, "*"); bench::keep(&r); }},
+    {"center()", 1048576, 49902.4, [](const bench::input& in) { auto r = center(in.s, len(in.s) + 11, "*"); bench::keep(&r); }},
+    {"count()", 16, 133.7, [](const bench::input& in) { auto r = count(in.s, "o"); bench::keep(&r); }},
+    {"count()", 1024, 1012.1, [](const bench::input& in) { auto r = count(in.s, "o"); bench::keep(&r); }},
+    {"count()", 1048576, 877877.8, [](const bench::input& in) { auto r = count(in.s, "o"); bench::keep(&r); }},
+    {"endswith()", 16, 163.0, [](const bench::input& in) { auto r = endswith(in.s, in.w); bench::keep(&r); }},
+    {"endswith()", 1024, 158.0, [](const bench::input& in) { auto r = endswith(in.s, in.w); bench::keep(&r); }},
+    {"endswith()", 1048576, 158.6, [](const bench::input& in) { auto r = endswith(in.s, in.w); bench::keep(&r); }},
+    {"expandtabs()", 16, 70.3, [](const bench::input& in) { auto r = expandtabs(in.s); bench::keep(&r); }},
+    {"expandtabs()", 1024, 4715.3, [](const bench::input& in) { auto r = expandtabs(in.s); bench::keep(&r); }},
+    {"expandtabs()", 1048576, 5003168.2, [](const bench::input& in) { auto r = expandtabs(in.s); bench::keep(&r); }},
+    {"find()", 16, 172.8, [](const bench::input& in) { auto r = find(in.s, "vow?"); bench::keep(&r); }},
+    {"find()", 1024, 1030.5, [](const bench::input& in) { auto r = find(in.s, "vow?"); bench::keep(&r); }},
+    {"find()", 1048576, 841027.6, [](const bench::input& in) { auto r = find(in.s, "vow?"); bench::keep(&r); }},
+    {"index()", 16, 177.8, [](const bench::input& in) { auto r = index(in.s, in.w); bench::keep(&r); }},
+    {"index()", 1024, 179.4, [](const bench::input& in) { auto r = index(in.s, in.w); bench::keep(&r); }},
+    {"index()", 1048576, 184.2, [](const bench::input& in) { auto r = index(in.s, in.w); bench::keep(&r); }},
+    {"isalnum()", 16, 55.3, [](const bench::input& in) { auto r = isalnum(in.s); bench::keep(&r); }},
+    {"isalnum()", 1024, 53.7, [](const bench::input& in) { auto r = isalnum(in.s); bench::keep(&r); }},
+    {"isalnum()", 1048576, 41.2, [](const bench::input& in) { auto r = isalnum(in.s); bench::keep(&r); }},
+    {"isalpha()", 16, 31.9, [](const bench::input& in) { auto r = isalpha(in.s); bench::keep(&r); }},
+    {"isalpha()", 1024, 35.5, [](const bench::input& in) { auto r = isalpha(in.s); bench::keep(&r); }},
+    {"isalpha()", 1048576, 30.0, [](const bench::input& in) { auto r = isalpha(in.s); bench::keep(&r); }},
+    {"isascii()", 16, 20.3, [](const bench::input& in) { auto r = isascii(in.s); bench::keep(&r); }},
+    {"isascii()", 1024, 18.9, [](const bench::input& in) { auto r = isascii(in.s); bench::keep(&r); }},
+    {"isascii()", 1048576, 20.6, [](const bench::input& in) { auto r = isascii(in.s); bench::keep(&r); }},
+    {"isdecimal()", 16, 34.8, [](const bench::input& in) { auto r = isdecimal(in.s); bench::keep(&r); }},
+    {"isdecimal()", 1024, 32.4, [](const bench::input& in) { auto r = isdecimal(in.s); bench::keep(&r); }},
+    {"isdecimal()", 1048576, 39.7, [](const bench::input& in) { auto r = isdecimal(in.s); bench::keep(&r); }},
+    {"isdigit()", 16, 34.7, [](const bench::input& in) { auto r = isdigit(in.s); bench::keep(&r); }},
+    {"isdigit()", 1024, 32.3, [](const bench::input& in) { auto r = isdigit(in.s); bench::keep(&r); }},
+    {"isdigit()", 1048576, 34.5, [](const bench::input& in) { auto r = isdigit(in.s); bench::keep(&r); }},
+    {"islower()", 16, 24.6, [](const bench::input& in) { auto r = islower(in.s); bench::keep(&r); }},
+    {"islower()", 1024, 23.8, [](const bench::input& in) { auto r = islower(in.s); bench::keep(&r); }},
+    {"islower()", 1048576, 20.1, [](const bench::input& in) { auto r = islower(in.s); bench::keep(&r); }},
+    {"isnumeric()", 16, 22.1, [](const bench::input& in) { auto r = isnumeric(in.s); bench::keep(&r); }},
+    {"isnumeric()", 1024, 31.5, [](const bench::input& in) { auto r = isnumeric(in.s); bench::keep(&r); }},
+    {"isnumeric()", 1048576, 21.4, [](const bench::input& in) { auto r = isnumeric(in.s); bench::keep(&r); }},
+    {"isprintable()", 16, 58.8, [](const bench::input& in) { auto r = isprintable(in.s); bench::keep(&r); }},
+    {"isprintable()", 1024, 193.0, [](const bench::input& in) { auto r = isprintable(in.s); bench::keep(&r); }},
+    {"isprintable()", 1048576, 202.2, [](const bench::input& in) { auto r = isprintable(in.s); bench::keep(&r); }},
+    {"isspace()", 16, 30.8, [](const bench::input& in) { auto r = isspace(in.s); bench::keep(&r); }},
+    {"isspace()", 1024, 28.6, [](const bench::input& in) { auto r = isspace(in.s); bench::keep(&r); }},
+    {"isspace()", 1048576, 24.1, [](const bench::input& in) { auto r = isspace(in.s); bench::keep(&r); }},
+    {"istitle()", 16, 73.1, [](const bench::input& in) { auto r = istitle(in.s); bench::keep(&r); }},
+    {"istitle()", 1024, 79.2, [](const bench::input& in) { auto r = istitle(in.s); bench::keep(&r); }},
+    {"istitle()", 1048576, 67.2, [](const bench::input& in) { auto r = istitle(in.s); bench::keep(&r); }},
+    {"isupper()", 16, 31.1, [](const bench::input& in) { auto r = isupper(in.s); bench::keep(&r); }},
+    {"isupper()", 1024, 29.4, [](const bench::input& in) { auto r = isupper(in.s); bench::keep(&r); }},
+    {"isupper()", 1048576, 38.5, [](const bench::input& in) { auto r = isupper(in.s); bench::keep(&r); }},
+    {"join()", 16, 63.7, [](const bench::input& in) { auto r = join(" ", in.v); bench::keep(&r); }},
+    {"join()", 1024, 1655.0, [](const bench::input& in) { auto r = join(" ", in.v); bench::keep(&r); }},
+    {"join()", 1048576, 2073033.2, [](const bench::input& in) { auto r = join(" ", in.v); bench::keep(&r); }},
+    {"ljust()", 16, 68.0, [](const bench::input& in) { auto r = ljust(in.s, len(in.s) + 11, "*"); bench::keep(&r); }},
+    {"ljust()", 1024, 145.0, [](const bench::input& in) { auto r = ljust(in.s, len(in.s) + 11, "*"); bench::keep(&r); }},
+    {"ljust()", 1048576, 46283.4, [](const bench::input& in) { auto r = ljust(in.s, len(in.s) + 11, "*"); bench::keep(&r); }},
+    {"lower()", 16, 53.2, [](const bench::input& in) { auto r = lower(in.s); bench::keep(&r); }},
+    {"lower()", 1024, 691.7, [](const bench::input& in) { auto r = lower(in.s); bench::keep(&r); }},
+    {"lower()", 1048576, 648212.2, [](const bench::input& in) { auto r = lower(in.s); bench::keep(&r); }},
+    {"lstrip()", 16, 26.4, [](const bench::input& in) { auto r = lstrip(in.s, " "); bench::keep(&r); }},
+    {"lstrip()", 1024, 24.1, [](const bench::input& in) { auto r = lstrip(in.s, " "); bench::keep(&r); }},
+    {"lstrip()", 1048576, 24.8, [](const bench::input& in) { auto r = lstrip(in.s, " "); bench::keep(&r); }},
+    {"partition()", 16, 98.7, [](const bench::input& in) { auto r = partition(in.s, in.w); bench::keep(&r); }},
+    {"partition()", 1024, 168.5, [](const bench::input& in) { auto r = partition(in.s, in.w); bench::keep(&r); }},
+    {"partition()", 1048576, 51618.7, [](const bench::input& in) { auto r = partition(in.s, in.w); bench::keep(&r); }},
+    {"replace()", 16, 92.5, [](const bench::input& in) { auto r = replace(in.s, "o", "0"); bench::keep(&r); }},
+    {"replace()", 1024, 730.3, [](const bench::input& in) { auto r = replace(in.s, "o", "0"); bench::keep(&r); }},
+    {"replace()", 1048576, 622738.5, [](const bench::input& in) { auto r = replace(in.s, "o", "0"); bench::keep(&r); }},
+    {"rfind()", 16, 103.0, [](const bench::input& in) { auto r = rfind(in.s, in.h); bench::keep(&r); }},
+    {"rfind()", 1024, 120.6, [](const bench::input& in) { auto r = rfind(in.s, in.h); bench::keep(&r); }},
+    {"rfind()", 1048576, 157.9, [](const bench::input& in) { auto r = rfind(in.s, in.h); bench::keep(&r); }},
+    {"rindex()", 16, 113.1, [](const bench::input& in) { auto r = rindex(in.s, in.h); bench::keep(&r); }},
+    {"rindex()", 1024, 150.5, [](const bench::input& in) { auto r = rindex(in.s, in.h); bench::keep(&r); }},
+    {"rindex()", 1048576, 145.3, [](const bench::input& in) { auto r = rindex(in.s, in.h); bench::keep(&r); }},
+    {"rjust()", 16, 105.3, [](const bench::input& in) { auto r = rjust(in.s, len(in.s) + 11, "*"); bench::keep(&r); }},
+    {"rjust()", 1024, 257.1, [](const bench::input& in) { auto r = rjust(in.s, len(in.s) + 11, "*"); bench::keep(&r); }},
+    {"rjust()", 1048576, 52646.4, [](const bench::input& in) { auto r = rjust(in.s, len(in.s) + 11, "*"); bench::keep(&r); }},
+    {"rpartition()", 16, 92.7, [](const bench::input& in) { auto r = rpartition(in.s, in.h); bench::keep(&r); }},
+    {"rpartition()", 1024, 167.8, [](const bench::input& in) { auto r = rpartition(in.s, in.h); bench::keep(&r); }},
+    {"rpartition()", 1048576, 41275.9, [](const bench::input& in) { auto r = rpartition(in.s, in.h); bench::keep(&r); }},
+    {"rsplit(sep)", 16, 153.0, [](const bench::input& in) { auto r = rsplit(in.s, " "); bench::keep(&r); }},
+    {"rsplit(sep)", 1024, 6015.4, [](const bench::input& in) { auto r = rsplit(in.s, " "); bench::keep(&r); }},
+    {"rsplit(sep)", 1048576, 11173675.1, [](const bench::input& in) { auto r = rsplit(in.s, " "); bench::keep(&r); }},
+    {"rsplit()", 16, 192.0, [](const bench::input& in) { auto r = rsplit(in.s); bench::keep(&r); }},
+    {"rsplit()", 1024, 8566.3, [](const bench::input& in) { auto r = rsplit(in.s); bench::keep(&r); }},
+    {"rsplit()", 1048576, 9593518.2, [](const bench::input& in) { auto r = rsplit(in.s); bench::keep(&r); }},
+    {"rstrip()", 16, 55.6, [](const bench::input& in) { auto r = rstrip(in.s, " "); bench::keep(&r); }},
+    {"rstrip()", 1024, 25.2, [](const bench::input& in) { auto r = rstrip(in.s, " "); bench::keep(&r); }},
+    {"rstrip()", 1048576, 30.7, [](const bench::input& in) { auto r = rstrip(in.s, " "); bench::keep(&r); }},
+    {"split(sep)", 16, 152.6, [](const bench::input& in) { auto r = split(in.s, " "); bench::keep(&r); }},
+    {"split(sep)", 1024, 6314.6, [](const bench::input& in) { auto r = split(in.s, " "); bench::keep(&r); }},
+    {"split(sep)", 1048576, 10887253.0, [](const bench::input& in) { auto r = split(in.s, " "); bench::keep(&r); }},
+    {"split()", 16, 157.6, [](const bench::input& in) { auto r = split(in.s); bench::keep(&r); }},
+    {"split()", 1024, 8179.2, [](const bench::input& in) { auto r = split(in.s); bench::keep(&r); }},
+    {"split()", 1048576, 12561376.2, [](const bench::input& in) { auto r = split(in.s); bench::keep(&r); }},
+    {"splitlines()", 16, 68.7, [](const bench::input& in) { auto r = splitlines(in.s); bench::keep(&r); }},
+    {"splitlines()", 1024, 1924.7, [](const bench::input& in) { auto r = splitlines(in.s); bench::keep(&r); }},
+    {"splitlines()", 1048576, 2207097.2, [](const bench::input& in) { auto r = splitlines(in.s); bench::keep(&r); }},
+    {"startswith()", 16, 130.7, [](const bench::input& in) { auto r = startswith(in.s, in.h); bench::keep(&r); }},
+    {"startswith()", 1024, 91.4, [](const bench::input& in) { auto r = startswith(in.s, in.h); bench::keep(&r); }},
+    {"startswith()", 1048576, 143.9, [](const bench::input& in) { auto r = startswith(in.s, in.h); bench::keep(&r); }},
+    {"strip()", 16, 57.7, [](const bench::input& in) { auto r = strip(in.s, " "); bench::keep(&r); }},
+    {"strip()", 1024, 30.7, [](const bench::input& in) { auto r = strip(in.s, " "); bench::keep(&r); }},
+    {"strip()", 1048576, 27.8, [](const bench::input& in) { auto r = strip(in.s, " "); bench::keep(&r); }},
+    {"swapcase()", 16, 186.4, [](const bench::input& in) { auto r = swapcase(in.s); bench::keep(&r); }},
+    {"swapcase()", 1024, 9075.2, [](const bench::input& in) { auto r = swapcase(in.s); bench::keep(&r); }},
+    {"swapcase()", 1048576, 8916506.8, [](const bench::input& in) { auto r = swapcase(in.s); bench::keep(&r); }},
+    {"title()", 16, 159.0, [](const bench::input& in) { auto r = title(in.s); bench::keep(&r); }},
+    {"title()", 1024, 8966.2, [](const bench::input& in) { auto r = title(in.s); bench::keep(&r); }},
+    {"title()", 1048576, 9418712.5, [](const bench::input& in) { auto r = title(in.s); bench::keep(&r); }},
+    {"upper()", 16, 67.9, [](const bench::input& in) { auto r = upper(in.s); bench::keep(&r); }},
+    {"upper()", 1024, 902.8, [](const bench::input& in) { auto r = upper(in.s); bench::keep(&r); }},
+    {"upper()", 1048576, 1027456.1, [](const bench::input& in) { auto r = upper(in.s); bench::keep(&r); }},
+    {"zfill()", 16, 97.3, [](const bench::input& in) { auto r = zfill(in.s, len(in.s) + 11); bench::keep(&r); }},
+    {"zfill()", 1024, 147.0, [](const bench::input& in) { auto r = zfill(in.s, len(in.s) + 11); bench::keep(&r); }},
+    {"zfill()", 1048576, 45359.6, [](const bench::input& in) { auto r = zfill(in.s, len(in.s) + 11); bench::keep(&r); }},
+};
+
+} // namespace {
+
+int main(int argc, char* argv[])
+{
+    return bench::run(items, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
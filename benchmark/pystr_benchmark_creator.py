@@ -0,0 +1,168 @@
+# -*- coding: utf-8 -*-
+"""pystr_benchmark_creator.py creates pystr_benchmark.cpp.
+
+Each benchmark is run by CPython first, and its timing is written into
+pystr_benchmark.cpp as the reference. Thus, the reference table can be
+regenerated in any environment without network access.
+"""
+
+import platform
+import timeit
+
+SIZES = (16, 1024, 1048576)
+
+# (name, Python expression, C++ expression)
+# s: text, t: copy of s, h: first 3 characters, w: last 3 characters,
+# v: s.split()
+BENCH_LIST = (
+    ('add()', 's + t', 'add(in.s, in.t)'),
+    ('contains()', "'vow?' in s", 'contains(in.s, "vow?")'),
+    ('eq()', 's == t', 'eq(in.s, in.t)'),
+    ('ge()', 's >= t', 'ge(in.s, in.t)'),
+    ('getitem()', 's[len(s) // 2]', 'getitem(in.s, len(in.s) / 2)'),
+    ('slice()', 's[1:-1:2]', 'slice(in.s, 1, -1, 2)'),
+    ('gt()', 's > t', 'gt(in.s, in.t)'),
+    ('le()', 's <= t', 'le(in.s, in.t)'),
+    ('len()', 'len(s)', 'len(in.s)'),
+    ('lt()', 's < t', 'lt(in.s, in.t)'),
+    ('mul()', 's * 3', 'mul(in.s, 3)'),
+    ('ne()', 's != t', 'ne(in.s, in.t)'),
+    ('repr()', 'repr(s)', 'repr(in.s)'),
+    ('rmul()', '3 * s', 'rmul(in.s, 3)'),
+    ('capitalize()', 's.capitalize()', 'capitalize(in.s)'),
+    ('casefold()', 's.casefold()', 'casefold(in.s)'),
+    ('center()', "s.center(len(s) + 11, '*')",
+     'center(in.s, len(in.s) + 11, "*")'),
+    ('count()', "s.count('o')", 'count(in.s, "o")'),
+    ('endswith()', 's.endswith(w)', 'endswith(in.s, in.w)'),
+    ('expandtabs()', 's.expandtabs()', 'expandtabs(in.s)'),
+    ('find()', "s.find('vow?')", 'find(in.s, "vow?")'),
+    ('index()', 's.index(w)', 'index(in.s, in.w)'),
+    ('isalnum()', 's.isalnum()', 'isalnum(in.s)'),
+    ('isalpha()', 's.isalpha()', 'isalpha(in.s)'),
+    ('isascii()', 's.isascii()', 'isascii(in.s)'),
+    ('isdecimal()', 's.isdecimal()', 'isdecimal(in.s)'),
+    ('isdigit()', 's.isdigit()', 'isdigit(in.s)'),
+    ('islower()', 's.islower()', 'islower(in.s)'),
+    ('isnumeric()', 's.isnumeric()', 'isnumeric(in.s)'),
+    ('isprintable()', 's.isprintable()', 'isprintable(in.s)'),
+    ('isspace()', 's.isspace()', 'isspace(in.s)'),
+    ('istitle()', 's.istitle()', 'istitle(in.s)'),
+    ('isupper()', 's.isupper()', 'isupper(in.s)'),
+    ('join()', "' '.join(v)", 'join(" ", in.v)'),
+    ('ljust()', "s.ljust(len(s) + 11, '*')",
+     'ljust(in.s, len(in.s) + 11, "*")'),
+    ('lower()', 's.lower()', 'lower(in.s)'),
+    ('lstrip()', "s.lstrip(' ')", 'lstrip(in.s, " ")'),
+    ('partition()', 's.partition(w)', 'partition(in.s, in.w)'),
+    ('replace()', "s.replace('o', '0')", 'replace(in.s, "o", "0")'),
+    ('rfind()', 's.rfind(h)', 'rfind(in.s, in.h)'),
+    ('rindex()', 's.rindex(h)', 'rindex(in.s, in.h)'),
+    ('rjust()', "s.rjust(len(s) + 11, '*')",
+     'rjust(in.s, len(in.s) + 11, "*")'),
+    ('rpartition()', 's.rpartition(h)', 'rpartition(in.s, in.h)'),
+    ('rsplit(sep)', "s.rsplit(' ')", 'rsplit(in.s, " ")'),
+    ('rsplit()', 's.rsplit()', 'rsplit(in.s)'),
+    ('rstrip()', "s.rstrip(' ')", 'rstrip(in.s, " ")'),
+    ('split(sep)', "s.split(' ')", 'split(in.s, " ")'),
+    ('split()', 's.split()', 'split(in.s)'),
+    ('splitlines()', 's.splitlines()', 'splitlines(in.s)'),
+    ('startswith()', 's.startswith(h)', 'startswith(in.s, in.h)'),
+    ('strip()', "s.strip(' ')", 'strip(in.s, " ")'),
+    ('swapcase()', 's.swapcase()', 'swapcase(in.s)'),
+    ('title()', 's.title()', 'title(in.s)'),
+    ('upper()', 's.upper()', 'upper(in.s)'),
+    ('zfill()', 's.zfill(len(s) + 11)', 'zfill(in.s, len(in.s) + 11)'),
+)
+
+
+def make_text(size):
+    """Create a deterministic text, which is same as bench::make_text()."""
+    pattern = ('The quick brown fox jumps over the lazy dog.\t'
+               'Sphinx of black quartz, judge my vow!\n')
+    return (pattern * (size // len(pattern) + 1))[:size]
+
+
+def make_input(size):
+    """Create globals for timeit, which is same as bench::input."""
+    s = make_text(size)
+    return {
+        's': s,
+        't': ''.join(list(s)),
+        'h': s[:3],
+        'w': s[-3:],
+        'v': s.split(),
+    }
+
+
+def measure(expr, inputs):
+    """Measure ns/op of expr by CPython. best of 5 repeats."""
+    timer = timeit.Timer(expr, globals=inputs)
+    number, _ = timer.autorange()
+    number = max(number, 1)
+    return min(timer.repeat(repeat=5, number=number)) / number * 1e9
+
+
+def create_items():
+    """Create text of bench::item array elements."""
+    inputs = {size: make_input(size) for size in SIZES}
+    for name, py_expr, cpp_expr in BENCH_LIST:
+        for size in SIZES:
+            ns = measure(py_expr, inputs[size])
+            yield ('    {{"{0}", {1}, {2:.1f}, [](const bench::input& in) '
+                   '{{ auto r = {3}; bench::keep(&r); }}}},'
+                   .format(name, size, ns, cpp_expr))
+
+
+def create_source():
+    """Create source file text."""
+    # yield header
+    yield """\
+/**
+ * @file    benchmark/pystr_benchmark.cpp
+ * @brief   Benchmark of ken3::pystr with CPython reference timings.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ * @note    This file is created by Python to get CPython reference timings.
+ *          Please, do not modify this file by manual.
+ *          The reference timings are measured by {0} {1} on {2}.
+ */
+
+#include "ken3/pystr.hpp"
+#include "benchmark/benchmark.hpp"
+
+namespace {{
+
+using namespace ken3::pystr;
+
+const bench::item items[] =
+{{""".format(platform.python_implementation(), platform.python_version(),
+            platform.machine())
+
+    # yield each benchmark items
+    yield from create_items()
+
+    # yield footer
+    yield """\
+};
+
+} // namespace {
+
+int main(int argc, char* argv[])
+{
+    return bench::run(items, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
+"""
+
+
+def main():
+    """Create pystr_benchmark.cpp file."""
+    with open('pystr_benchmark.cpp', 'w') as file:
+        file.write('\n'.join(create_source()))
+
+
+if __name__ == '__main__':
+    main()
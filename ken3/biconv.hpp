@@ -15,19 +15,243 @@
  *                                {'D', 13}, {'E', 14}, {'F', 15}};
  *     std::cout << bc.convert('A'); // => 10
  *     std::cout << bc.rconvert(15); // => 'F'
+ *
+ * biconv_type::hashed builds hash indexes of both datasets at construction,
+ * thus convert() and rconvert() cost O(1) instead of O(n). it needs
+ * std::hash of F and S. small datasets, whose size is less than
+ * biconv_hashed_threshold, are searched linearly without indexes.
+ *     ken3::biconv<int, std::string, ken3::biconv_type::hashed> bc{...};
+ *
+ * integral, enum, and pointer elements are also stored in a column, which
+ * has only the elements of one dataset. linear search scans the column
+ * instead of pairs. 4 bytes elements are compared by SSE2 if available.
+ *
+ * convert_many() and rconvert_many() convert a batch. biconv_type::linear
+ * sorts elements of a column once for a large batch of forward iterators,
+ * thus the batch costs O((n + k) log n) instead of O(n * k).
+ *     bc.convert_many(codes.begin(), codes.end(), names.begin(), "unknown");
  */
 
 #ifndef INCLUDE_GUARD_KEN3_BICONV_HPP
 #define INCLUDE_GUARD_KEN3_BICONV_HPP
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 namespace ken3 {
 
+/**
+ * @enum    biconv_type
+ * @brief   search method of biconv.
+ *          linear: biconv searches datasets linearly. F and S need only operator==.
+ *          hashed: biconv searches datasets by hash indexes. F and S need std::hash.
+ */
+enum class biconv_type
+{
+    linear,
+    hashed,
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   minimum size of datasets, which biconv_type::hashed builds indexes for.
+ *          linear search of a few elements is faster than hashing.
+ */
+constexpr std::size_t biconv_hashed_threshold = 16;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   minimum size of columns, which biconv_type::linear sorts for a batch.
+ *          the batch also needs a quarter of elements of the column, because
+ *          scanning a few elements by SSE2 is faster than sorting the column.
+ */
+constexpr std::size_t biconv_batch_threshold = 512;
+/////////////////////////////////////////////////////////////////////////////
+
+namespace biconv_detail {
+
+/**
+ * @struct  no_index
+ * @brief   index of biconv_type::linear, which has nothing.
+ */
+struct no_index
+{
+    no_index(void) noexcept
+    {
+    }
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct  is_column_searchable
+ * @brief   true if T is compared by bits, thus it is searched in a column.
+ *          bool is excluded, because std::vector<bool> has no data().
+ */
+template <typename T>
+struct is_column_searchable : std::integral_constant<bool,
+    (std::is_integral<T>::value && !std::is_same<T, bool>::value) || std::is_enum<T>::value || std::is_pointer<T>::value>
+{
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct  use_sse2
+ * @brief   true if T is searched by SSE2, which compares 4 bytes elements.
+ */
+template <typename T>
+struct use_sse2 : std::integral_constant<bool,
+#if defined(__SSE2__)
+    sizeof(T) == 4
+#else
+    false
+#endif
+>
+{
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      find element in column.
+ * @param[in]  column: elements of dataset.
+ * @param[in]  element: appointed element.
+ * @param[in]  dummy: compile switcher. in this case, SSE2 is not used.
+ * @return     position of the first found element. column.size() if not found.
+ */
+template <typename T>
+std::size_t scan(const std::vector<T>& column, const T& element, std::false_type dummy) noexcept
+{
+    return static_cast<std::size_t>(std::find(column.begin(), column.end(), element) - column.begin());
+}
+/////////////////////////////////////////////////////////////////////////////
+
+#if defined(__SSE2__)
+/**
+ * @brief      find element in column by SSE2. 8 elements are compared at
+ *             once into a bit mask, without branches in the block.
+ * @param[in]  column: elements of dataset.
+ * @param[in]  element: appointed element.
+ * @param[in]  dummy: compile switcher. in this case, SSE2 is used.
+ * @return     position of the first found element. column.size() if not found.
+ */
+template <typename T>
+std::size_t scan(const std::vector<T>& column, const T& element, std::true_type dummy) noexcept
+{
+    const T* data = column.data();
+    std::size_t size = column.size();
+    std::int32_t bits;
+    std::memcpy(&bits, &element, sizeof(bits));
+    const __m128i x = _mm_set1_epi32(bits);
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m128i lo = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), x);
+        __m128i hi = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 4)), x);
+        unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(lo)) |
+                                              (_mm_movemask_ps(_mm_castsi128_ps(hi)) << 4));
+        if (mask != 0) {
+            return i + static_cast<std::size_t>(__builtin_ctz(mask));
+        }
+    }
+    for (; i < size; i++) {
+        if (data[i] == element) {
+            return i;
+        }
+    }
+    return size;
+}
+/////////////////////////////////////////////////////////////////////////////
+#endif
+
+/**
+ * @brief      find element in column.
+ * @param[in]  column: elements of dataset.
+ * @param[in]  element: appointed element.
+ * @return     position of the first found element. column.size() if not found.
+ */
+template <typename T>
+std::size_t scan(const std::vector<T>& column, const T& element) noexcept
+{
+    return scan(column, element, use_sse2<T>{});
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      sort elements of column with their positions. the first one
+ *             comes first if element is duplex, as same as linear search.
+ * @param[in]  column: elements of dataset.
+ * @return     pairs of element and position in order of elements.
+ */
+template <typename T>
+std::vector<std::pair<T, std::size_t>> sort_column(const std::vector<T>& column)
+{
+    std::vector<std::pair<T, std::size_t>> sorted;
+    sorted.reserve(column.size());
+    for (std::size_t i = 0; i < column.size(); i++) {
+        sorted.emplace_back(column[i], i);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const std::pair<T, std::size_t>& lhs, const std::pair<T, std::size_t>& rhs) {
+        return std::less<T>()(lhs.first, rhs.first) || (!std::less<T>()(rhs.first, lhs.first) && (lhs.second < rhs.second));
+    });
+    return sorted;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      find element in sorted column by binary search.
+ * @param[in]  sorted: pairs of element and position in order of elements.
+ * @param[in]  element: appointed element.
+ * @return     position of the first found element. sorted.size() if not found.
+ */
+template <typename T>
+std::size_t search(const std::vector<std::pair<T, std::size_t>>& sorted, const T& element)
+{
+    auto i = std::lower_bound(sorted.begin(), sorted.end(), element, [](const std::pair<T, std::size_t>& lhs, const T& rhs) {
+        return std::less<T>()(lhs.first, rhs);
+    });
+    return ((i != sorted.end()) && (i->first == element)) ? i->second : sorted.size();
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      split a batch into chunks, and convert them by thread pool.
+ * @param[in]  pool: thread pool, which has size() and parallel_for(n, func)
+ *             as same as ken3::pystr::parallel::thread_pool.
+ * @param[in]  first: first random access iterator of source elements.
+ * @param[in]  last: last random access iterator of source elements.
+ * @param[out] out: random access iterator of converted elements.
+ * @param[in]  func: converter of a chunk, which is called as func(first, last, out).
+ * @return     output iterator after the last converted element.
+ */
+template <typename Pool, typename RandomIt, typename OutputIt, typename Func>
+OutputIt parallel_many(Pool& pool, RandomIt first, RandomIt last, OutputIt out, Func func)
+{
+    constexpr std::size_t chunk = 16384;
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    const std::size_t chunks = std::max<std::size_t>(1, std::min<std::size_t>(pool.size() + 1, n / chunk));
+    pool.parallel_for(chunks, [&](std::size_t c) {
+        const std::size_t begin = (n / chunks) * c + std::min(c, n % chunks);
+        const std::size_t end = (n / chunks) * (c + 1) + std::min(c + 1, n % chunks);
+        func(first + begin, first + end, out + begin);
+    });
+    return out + n;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace biconv_detail {
+
 /**
  * @class   biconv
  * @brief   This class holds two datasets, one is F, the other is S.
@@ -36,14 +260,37 @@ namespace ken3 {
  *          biconv::rconvert() converts S to F.
  * @tparam  F: type of first dataset.
  * @tparam  S: type of second dataset.
+ * @tparam  TYPE: biconv_type. default is linear.
  */
-template <typename F, typename S>
+template <typename F, typename S, biconv_type TYPE = biconv_type::linear>
 class biconv {
+    // static_asserts
+    static_assert(
+        TYPE == biconv_type::linear ||
+        TYPE == biconv_type::hashed,
+        "unknown type for biconv"
+    );
+
     // type definition
 public:
     using value_type = std::pair<F, S>;
 private:
-    using self_type = biconv<F, S>;
+    using self_type = biconv<F, S, TYPE>;
+    using is_hashed = std::integral_constant<bool, TYPE == biconv_type::hashed>;
+    template <std::size_t N>
+    using element_type = typename std::tuple_element<N, value_type>::type;
+    template <std::size_t N>
+    using index_type = typename std::conditional<is_hashed::value,
+                       std::unordered_map<element_type<N>, std::size_t>, biconv_detail::no_index>::type;
+    template <std::size_t N>
+    using is_column = biconv_detail::is_column_searchable<element_type<N>>;
+    template <std::size_t N>
+    using column_type = typename std::conditional<is_column<N>::value,
+                        std::vector<element_type<N>>, biconv_detail::no_index>::type;
+    template <std::size_t N, typename It>
+    using is_batch = std::integral_constant<bool, !is_hashed::value && is_column<N>::value &&
+                     std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>::value>;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
     /////////////////////////////////////////////////////////////////////////////
 
 public:
@@ -63,7 +310,24 @@ public:
      * @param[in]  init: paired data to be registered.
      */
     biconv(std::initializer_list<value_type> init):
-        values_(init.begin(), init.end())
+        values_(init.begin(), init.end()),
+        indexes_(make_index<0>(values_, is_hashed{}), make_index<1>(values_, is_hashed{})),
+        columns_(make_column<0>(values_, is_column<0>{}), make_column<1>(values_, is_column<1>{}))
+    {
+        ;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      iterator constructor.
+     * @param[in]  first: first iterator of paired data to be registered.
+     * @param[in]  last: last iterator of paired data to be registered.
+     */
+    template <typename InputIt>
+    biconv(InputIt first, InputIt last):
+        values_(first, last),
+        indexes_(make_index<0>(values_, is_hashed{}), make_index<1>(values_, is_hashed{})),
+        columns_(make_column<0>(values_, is_column<0>{}), make_column<1>(values_, is_column<1>{}))
     {
         ;
     }
@@ -127,6 +391,110 @@ public:
     }
     /////////////////////////////////////////////////////////////////////////////
 
+    /**
+     * @brief      convert elements of first dataset in a batch.
+     * @param[in]  first: first iterator of first dataset elements.
+     * @param[in]  last: last iterator of first dataset elements.
+     * @param[out] out: output iterator of second dataset elements.
+     * @return     output iterator after the last converted element.
+     * @throw      std::out_of_range: if an element is not found in first dataset.
+     *             elements before it are already written.
+     */
+    template <typename InputIt, typename OutputIt>
+    OutputIt convert_many(InputIt first, InputIt last, OutputIt out) const
+    {
+        return convert_many_impl<0>(first, last, out, nullptr, is_batch<0, InputIt>{});
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert elements of first dataset in a batch.
+     *             this function never throws exceptions of not found.
+     * @param[in]  first: first iterator of first dataset elements.
+     * @param[in]  last: last iterator of first dataset elements.
+     * @param[out] out: output iterator of second dataset elements.
+     * @param[in]  defaultS: written element if an element is not found.
+     * @return     output iterator after the last converted element.
+     */
+    template <typename InputIt, typename OutputIt>
+    OutputIt convert_many(InputIt first, InputIt last, OutputIt out, const S& defaultS) const
+    {
+        return convert_many_impl<0>(first, last, out, &defaultS, is_batch<0, InputIt>{});
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert elements of first dataset in a batch by threads.
+     *             the batch is split into chunks for each thread of pool.
+     * @param[in]  pool: thread pool, which has size() and parallel_for(n, func)
+     *             as same as ken3::pystr::parallel::thread_pool.
+     * @param[in]  first: first random access iterator of first dataset elements.
+     * @param[in]  last: last random access iterator of first dataset elements.
+     * @param[out] out: random access iterator of second dataset elements.
+     * @param[in]  defaultS: written element if an element is not found.
+     * @return     output iterator after the last converted element.
+     */
+    template <typename Pool, typename RandomIt, typename OutputIt>
+    OutputIt convert_many(Pool& pool, RandomIt first, RandomIt last, OutputIt out, const S& defaultS) const
+    {
+        return biconv_detail::parallel_many(pool, first, last, out, [this, &defaultS](RandomIt f, RandomIt l, OutputIt o) {
+            convert_many(f, l, o, defaultS);
+        });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert elements of second dataset in a batch.
+     * @param[in]  first: first iterator of second dataset elements.
+     * @param[in]  last: last iterator of second dataset elements.
+     * @param[out] out: output iterator of first dataset elements.
+     * @return     output iterator after the last converted element.
+     * @throw      std::out_of_range: if an element is not found in second dataset.
+     *             elements before it are already written.
+     */
+    template <typename InputIt, typename OutputIt>
+    OutputIt rconvert_many(InputIt first, InputIt last, OutputIt out) const
+    {
+        return convert_many_impl<1>(first, last, out, nullptr, is_batch<1, InputIt>{});
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert elements of second dataset in a batch.
+     *             this function never throws exceptions of not found.
+     * @param[in]  first: first iterator of second dataset elements.
+     * @param[in]  last: last iterator of second dataset elements.
+     * @param[out] out: output iterator of first dataset elements.
+     * @param[in]  defaultF: written element if an element is not found.
+     * @return     output iterator after the last converted element.
+     */
+    template <typename InputIt, typename OutputIt>
+    OutputIt rconvert_many(InputIt first, InputIt last, OutputIt out, const F& defaultF) const
+    {
+        return convert_many_impl<1>(first, last, out, &defaultF, is_batch<1, InputIt>{});
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert elements of second dataset in a batch by threads.
+     *             the batch is split into chunks for each thread of pool.
+     * @param[in]  pool: thread pool, which has size() and parallel_for(n, func)
+     *             as same as ken3::pystr::parallel::thread_pool.
+     * @param[in]  first: first random access iterator of second dataset elements.
+     * @param[in]  last: last random access iterator of second dataset elements.
+     * @param[out] out: random access iterator of first dataset elements.
+     * @param[in]  defaultF: written element if an element is not found.
+     * @return     output iterator after the last converted element.
+     */
+    template <typename Pool, typename RandomIt, typename OutputIt>
+    OutputIt rconvert_many(Pool& pool, RandomIt first, RandomIt last, OutputIt out, const F& defaultF) const
+    {
+        return biconv_detail::parallel_many(pool, first, last, out, [this, &defaultF](RandomIt f, RandomIt l, OutputIt o) {
+            rconvert_many(f, l, o, defaultF);
+        });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
     /**
      * @brief      check if f is in first dataset.
      * @param[in]  f: appointed element of first dataset.
@@ -151,13 +519,121 @@ public:
 
 private:
     /**
-     * @brief      find check if s is in second dataset.
+     * @brief      convert elements in a batch one by one.
+     * @tparam     N: 0 means first dataset, 1 means second dataset.
+     * @param[in]  first: first iterator of source elements.
+     * @param[in]  last: last iterator of source elements.
+     * @param[out] out: output iterator of converted elements.
+     * @param[in]  defaultV: written element if not found. nullptr means throwing.
+     * @param[in]  dummy: compile switcher. in this case, column is not sorted.
+     * @return     output iterator after the last converted element.
+     */
+    template <std::size_t N, typename InputIt, typename OutputIt>
+    OutputIt convert_many_impl(InputIt first, InputIt last, OutputIt out,
+                               const element_type<1 - N>* defaultV, std::false_type dummy) const
+    {
+        for (auto i = first; i != last; ++i, ++out) {
+            auto iter = find<N>(*i);
+            *out = (iter != values_.end()) ? std::get<1 - N>(*iter) : not_found<N>(defaultV);
+        }
+        return out;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert elements in a batch. a large batch is converted by
+     *             binary search in sorted elements of column.
+     * @tparam     N: 0 means first dataset, 1 means second dataset.
+     * @param[in]  first: first forward iterator of source elements.
+     * @param[in]  last: last forward iterator of source elements.
+     * @param[out] out: output iterator of converted elements.
+     * @param[in]  defaultV: written element if not found. nullptr means throwing.
+     * @param[in]  dummy: compile switcher. in this case, column may be sorted.
+     * @return     output iterator after the last converted element.
+     */
+    template <std::size_t N, typename ForwardIt, typename OutputIt>
+    OutputIt convert_many_impl(ForwardIt first, ForwardIt last, OutputIt out,
+                               const element_type<1 - N>* defaultV, std::true_type dummy) const
+    {
+        const std::vector<element_type<N>>& column = std::get<N>(columns_);
+        if ((column.size() < biconv_batch_threshold) ||
+            (static_cast<std::size_t>(std::distance(first, last)) * 4 < column.size())) {
+            return convert_many_impl<N>(first, last, out, defaultV, std::false_type{});
+        }
+        const auto sorted = biconv_detail::sort_column(column);
+        for (auto i = first; i != last; ++i, ++out) {
+            const element_type<N>& element = *i;
+            std::size_t pos = biconv_detail::search(sorted, element);
+            *out = (pos != values_.size()) ? std::get<1 - N>(values_[pos]) : not_found<N>(defaultV);
+        }
+        return out;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get converted element when source element is not found.
+     * @tparam     N: 0 means first dataset, 1 means second dataset.
+     * @param[in]  defaultV: default element. nullptr means throwing.
+     * @return     defaultV
+     * @throw      std::out_of_range: if defaultV is nullptr.
+     */
+    template <std::size_t N>
+    const element_type<1 - N>& not_found(const element_type<1 - N>* defaultV) const
+    {
+        return (defaultV != nullptr) ? *defaultV : throw std::out_of_range((N == 0) ? "biconv::conv()" : "biconv::rconv()");
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      find element in dataset.
+     * @param[in]  element: appointed element of dataset.
+     * @tparam     N: 0 means first dataset, 1 means second dataset.
+     * @return     found iterator value_type. maybe values_end().
+     */
+    template <std::size_t N>
+    const_iterator find(const element_type<N>& element) const
+    {
+        return find_impl<N>(element, is_hashed{});
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      find element in dataset linearly.
+     * @param[in]  element: appointed element of dataset.
+     * @param[in]  dummy: compile switcher. in this case, TYPE == linear.
+     * @tparam     N: 0 means first dataset, 1 means second dataset.
+     * @return     found iterator value_type. maybe values_end().
+     */
+    template <std::size_t N>
+    const_iterator find_impl(const element_type<N>& element, std::false_type dummy) const
+    {
+        return find_linear<N>(element, is_column<N>{});
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      find element in column of dataset.
      * @param[in]  element: appointed element of dataset.
+     * @param[in]  dummy: compile switcher. in this case, element is in column.
      * @tparam     N: 0 means first dataset, 1 means second dataset.
      * @return     found iterator value_type. maybe values_end().
      */
-    template <size_t N>
-    typename std::vector<value_type>::const_iterator find(const typename std::tuple_element<N, value_type>::type& element) const
+    template <std::size_t N>
+    const_iterator find_linear(const element_type<N>& element, std::true_type dummy) const
+    {
+        return values_.begin() + biconv_detail::scan(std::get<N>(columns_), element);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      find element in pairs of dataset.
+     * @param[in]  element: appointed element of dataset.
+     * @param[in]  dummy: compile switcher. in this case, element is not in column.
+     * @tparam     N: 0 means first dataset, 1 means second dataset.
+     * @return     found iterator value_type. maybe values_end().
+     */
+    template <std::size_t N>
+    const_iterator find_linear(const element_type<N>& element, std::false_type dummy) const
     {
         return std::find_if(
             values_.begin(), values_.end(), 
@@ -166,7 +642,100 @@ private:
     }
     /////////////////////////////////////////////////////////////////////////////
 
+    /**
+     * @brief      find element in dataset by hash index.
+     *             if the index is not built, find element linearly.
+     * @param[in]  element: appointed element of dataset.
+     * @param[in]  dummy: compile switcher. in this case, TYPE == hashed.
+     * @tparam     N: 0 means first dataset, 1 means second dataset.
+     * @return     found iterator value_type. maybe values_end().
+     */
+    template <std::size_t N>
+    const_iterator find_impl(const element_type<N>& element, std::true_type dummy) const
+    {
+        const index_type<N>& index = std::get<N>(indexes_);
+        if (index.empty()) {
+            return find_impl<N>(element, std::false_type{});
+        }
+        auto i = index.find(element);
+        return (i != index.end()) ? (values_.begin() + i->second) : values_.end();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      make index of dataset.
+     * @param[in]  values: registered datasets.
+     * @param[in]  dummy: compile switcher. in this case, TYPE == linear.
+     * @tparam     N: 0 means first dataset, 1 means second dataset.
+     * @return     empty index.
+     */
+    template <std::size_t N>
+    static index_type<N> make_index(const std::vector<value_type>& values, std::false_type dummy)
+    {
+        return index_type<N>();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      make hash index of dataset, which maps element to position
+     *             in values. the first one is indexed if element is duplex,
+     *             as same as linear search.
+     * @param[in]  values: registered datasets.
+     * @param[in]  dummy: compile switcher. in this case, TYPE == hashed.
+     * @tparam     N: 0 means first dataset, 1 means second dataset.
+     * @return     hash index. it is empty if values are less than threshold.
+     */
+    template <std::size_t N>
+    static index_type<N> make_index(const std::vector<value_type>& values, std::true_type dummy)
+    {
+        index_type<N> index;
+        if (values.size() < biconv_hashed_threshold) {
+            return index;
+        }
+        index.reserve(values.size());
+        for (std::size_t i = 0; i < values.size(); i++) {
+            index.emplace(std::get<N>(values[i]), i);
+        }
+        return index;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      make column of dataset.
+     * @param[in]  values: registered datasets.
+     * @param[in]  dummy: compile switcher. in this case, element is not in column.
+     * @tparam     N: 0 means first dataset, 1 means second dataset.
+     * @return     empty column.
+     */
+    template <std::size_t N>
+    static column_type<N> make_column(const std::vector<value_type>& values, std::false_type dummy)
+    {
+        return column_type<N>();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      make column of dataset, which has elements in order of values.
+     * @param[in]  values: registered datasets.
+     * @param[in]  dummy: compile switcher. in this case, element is in column.
+     * @tparam     N: 0 means first dataset, 1 means second dataset.
+     * @return     column.
+     */
+    template <std::size_t N>
+    static column_type<N> make_column(const std::vector<value_type>& values, std::true_type dummy)
+    {
+        column_type<N> column;
+        column.reserve(values.size());
+        for (const auto& i: values) {
+            column.push_back(std::get<N>(i));
+        }
+        return column;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
     const std::vector<value_type> values_; // registered datasets
+    const std::tuple<index_type<0>, index_type<1>> indexes_ = std::tuple<index_type<0>, index_type<1>>(); // indexes of datasets
+    const std::tuple<column_type<0>, column_type<1>> columns_ = std::tuple<column_type<0>, column_type<1>>(); // columns of datasets
     /////////////////////////////////////////////////////////////////////////////
 
 };
@@ -0,0 +1,518 @@
+/**
+ * @file    ken3/biconv/static.hpp
+ * @brief   Implementation of static_biconv class.
+ *          static_biconv is constexpr version of ken3::biconv for literal tables.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more.
+ * @remark  this module works only with header files.
+ *
+ * @note
+ * Typical usage is;
+ *     constexpr ken3::static_biconv<char, int, 3> bc{{{'A', 10}, {'B', 11}, {'C', 12}}};
+ *     static_assert(bc.convert('A') == 10, "folded at compile time");
+ *     std::cout << bc.rconvert(n); // binary search at run time
+ *
+ * static_biconv keeps pairs in an array, and sorts the orders of both
+ * datasets at compile time. thus, it needs neither heap nor initialization
+ * at run time. convert() and rconvert() are binary search, which is also
+ * evaluated at compile time for constant arguments. F and S shall be
+ * literal types with operator< and operator==, such as integral and enum.
+ * orders are sorted by bitonic sorting network, whose cost is O(n log^2 n)
+ * in compile time. tables of about a thousand pairs are built within the
+ * default limits of g++, larger tables need -fconstexpr-ops-limit.
+ * if an element is duplex, the first one is found, as same as ken3::biconv.
+ */
+
+#ifndef INCLUDE_GUARD_KEN3_BICONV_STATIC_HPP
+#define INCLUDE_GUARD_KEN3_BICONV_STATIC_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ken3 {
+
+namespace biconv_detail {
+
+/**
+ * @struct  index_sequence
+ * @brief   sequence of indexes, which is same as std::index_sequence of C++14.
+ */
+template <std::size_t... Is>
+struct index_sequence
+{
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct  make_index_sequence_impl
+ * @brief   make index_sequence<0, 1, ..., N - 1> by halving N.
+ */
+template <std::size_t N, typename V = void>
+struct make_index_sequence_impl;
+
+template <typename L, typename R>
+struct concat_index_sequence;
+
+template <std::size_t... Ls, std::size_t... Rs>
+struct concat_index_sequence<index_sequence<Ls...>, index_sequence<Rs...>>
+{
+    using type = index_sequence<Ls..., (sizeof...(Ls) + Rs)...>;
+};
+
+template <std::size_t N>
+struct make_index_sequence_impl<N, typename std::enable_if<(N == 0)>::type>
+{
+    using type = index_sequence<>;
+};
+
+template <std::size_t N>
+struct make_index_sequence_impl<N, typename std::enable_if<(N == 1)>::type>
+{
+    using type = index_sequence<0>;
+};
+
+template <std::size_t N>
+struct make_index_sequence_impl<N, typename std::enable_if<(N > 1)>::type>
+{
+    using type = typename concat_index_sequence<typename make_index_sequence_impl<N / 2>::type,
+                                                typename make_index_sequence_impl<N - N / 2>::type>::type;
+};
+
+template <std::size_t N>
+using make_index_sequence = typename make_index_sequence_impl<N>::type;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      get the least power of 2, which is not less than n.
+ * @param[in]  n: value
+ * @param[in]  p: candidate, which is a power of 2.
+ * @return     power of 2
+ */
+constexpr std::size_t ceil_pow2(std::size_t n, std::size_t p)
+{
+    return (p >= n) ? p : ceil_pow2(n, p * 2);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct  index_array
+ * @brief   literal array of indexes, which is returned by constexpr functions.
+ */
+template <std::size_t N>
+struct index_array
+{
+    std::size_t data[N];
+};
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace biconv_detail {
+
+/**
+ * @class   static_biconv
+ * @brief   This class holds two datasets of literal types at compile time.
+ *          static_biconv::convert() converts F to S.
+ *          static_biconv::rconvert() converts S to F.
+ * @tparam  F: type of first dataset.
+ * @tparam  S: type of second dataset.
+ * @tparam  N: the number of pairs.
+ */
+template <typename F, typename S, std::size_t N>
+class static_biconv {
+    // static_asserts
+    static_assert(N > 0, "static_biconv needs one pair at least");
+
+    // type definition
+public:
+    using value_type = std::pair<F, S>;
+private:
+    using self_type = static_biconv<F, S, N>;
+    using first_tag = std::integral_constant<std::size_t, 0>;
+    using second_tag = std::integral_constant<std::size_t, 1>;
+    static constexpr std::size_t padded_size = biconv_detail::ceil_pow2(N, 1);
+    using order_array = biconv_detail::index_array<padded_size>;
+    /////////////////////////////////////////////////////////////////////////////
+
+public:
+    /**
+     * @brief      constructor with array of pairs. orders are sorted at compile
+     *             time if this object is constexpr.
+     * @param[in]  init: paired data to be registered.
+     */
+    constexpr static_biconv(const value_type (&init)[N]) :
+        static_biconv(init, biconv_detail::make_index_sequence<N>{})
+    {
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get the number of pairs.
+     * @return     N
+     */
+    constexpr std::size_t size(void) const noexcept
+    {
+        return N;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert an element of first dataset to a second dataset element.
+     * @param[in]  f: appointed element of first dataset.
+     * @return     converted element of second dataset.
+     * @throw      std::out_of_range: if f is not found in first dataset.
+     *             it is a compile error in constant expression.
+     */
+    constexpr S convert(const F& f) const
+    {
+        return second_at(find(f, first_tag{}));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert an element of first dataset to a second dataset element.
+     * @param[in]  f: appointed element of first dataset.
+     * @param[in]  defaultS: returned value if f is not found.
+     * @return     converted element of second dataset. if f is not found in first dataset,
+     *             then defaultS is returned.
+     */
+    constexpr S convert(const F& f, const S& defaultS) const
+    {
+        return second_or(find(f, first_tag{}), defaultS);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert an element of second dataset to a first dataset element.
+     * @param[in]  s: appointed element of second dataset.
+     * @return     converted element of first dataset.
+     * @throw      std::out_of_range: if s is not found in second dataset.
+     *             it is a compile error in constant expression.
+     */
+    constexpr F rconvert(const S& s) const
+    {
+        return first_at(find(s, second_tag{}));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert an element of second dataset to a first dataset element.
+     * @param[in]  s: appointed element of second dataset.
+     * @param[in]  defaultF: returned value if s is not found.
+     * @return     converted element of first dataset. if s is not found in second dataset,
+     *             then defaultF is returned.
+     */
+    constexpr F rconvert(const S& s, const F& defaultF) const
+    {
+        return first_or(find(s, second_tag{}), defaultF);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      check if f is in first dataset.
+     * @param[in]  f: appointed element of first dataset.
+     * @return     true: found. false: not found.
+     */
+    constexpr bool containF(const F& f) const
+    {
+        return find(f, first_tag{}) < N;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      check if s is in second dataset.
+     * @param[in]  s: appointed element of second dataset.
+     * @return     true: found. false: not found.
+     */
+    constexpr bool containS(const S& s) const
+    {
+        return find(s, second_tag{}) < N;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    /**
+     * @brief      constructor with indexes of pairs, which sorts orders once.
+     * @param[in]  init: paired data to be registered.
+     * @param[in]  dummy: indexes of pairs.
+     */
+    template <std::size_t... Is>
+    constexpr static_biconv(const value_type (&init)[N], biconv_detail::index_sequence<Is...> dummy) :
+        static_biconv(init, sort(init, first_tag{}), sort(init, second_tag{}), dummy)
+    {
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with sorted orders of both datasets.
+     * @param[in]  init: paired data to be registered.
+     * @param[in]  f_order: sorted order of first dataset.
+     * @param[in]  s_order: sorted order of second dataset.
+     * @param[in]  dummy: indexes of pairs.
+     */
+    template <std::size_t... Is>
+    constexpr static_biconv(const value_type (&init)[N], const order_array& f_order,
+                            const order_array& s_order, biconv_detail::index_sequence<Is...> dummy) :
+        values_{init[Is]...},
+        f_order_{f_order.data[Is]...},
+        s_order_{s_order.data[Is]...}
+    {
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get element of pair.
+     * @param[in]  v: pair
+     * @param[in]  tag: compile switcher. in this case, first.
+     * @return     v.first
+     */
+    static constexpr const F& get(const value_type& v, first_tag tag)
+    {
+        return v.first;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get element of pair.
+     * @param[in]  v: pair
+     * @param[in]  tag: compile switcher. in this case, second.
+     * @return     v.second
+     */
+    static constexpr const S& get(const value_type& v, second_tag tag)
+    {
+        return v.second;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      compare pairs in init. the tie is broken by index, and
+     *             index N is a padding, which is after all pairs.
+     * @param[in]  init: registered pairs.
+     * @param[in]  i: index of left hand side.
+     * @param[in]  j: index of right hand side.
+     * @param[in]  tag: compile switcher of dataset.
+     * @return     true if init[i] is before init[j] in sorted order.
+     */
+    template <typename TAG>
+    static constexpr bool before(const value_type (&init)[N], std::size_t i, std::size_t j, TAG tag)
+    {
+        return (i == N) ? false
+             : (j == N) ? true
+             : (get(init[i], tag) < get(init[j], tag)) ||
+               (!(get(init[j], tag) < get(init[i], tag)) && (i < j));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get one element after a compare-exchange stage of bitonic sort.
+     * @param[in]  init: registered pairs.
+     * @param[in]  a: order before the stage.
+     * @param[in]  i: position of element.
+     * @param[in]  k: size of bitonic sequences, which are merged in the stage.
+     * @param[in]  j: distance of compared elements.
+     * @param[in]  tag: compile switcher of dataset.
+     * @return     index of pair at position i after the stage.
+     */
+    template <typename TAG>
+    static constexpr std::size_t exchange(const value_type (&init)[N], const order_array& a,
+                                          std::size_t i, std::size_t k, std::size_t j, TAG tag)
+    {
+        return ((((i & k) == 0) == (i < (i ^ j))) == before(init, a.data[i], a.data[i ^ j], tag))
+               ? a.data[i] : a.data[i ^ j];
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      process a compare-exchange stage of bitonic sort.
+     * @param[in]  init: registered pairs.
+     * @param[in]  a: order before the stage.
+     * @param[in]  k: size of bitonic sequences, which are merged in the stage.
+     * @param[in]  j: distance of compared elements.
+     * @param[in]  tag: compile switcher of dataset.
+     * @param[in]  dummy: positions of order.
+     * @return     order after the stage.
+     */
+    template <typename TAG, std::size_t... Is>
+    static constexpr order_array stage(const value_type (&init)[N], const order_array& a, std::size_t k, std::size_t j,
+                                       TAG tag, biconv_detail::index_sequence<Is...> dummy)
+    {
+        return order_array{{exchange(init, a, Is, k, j, tag)...}};
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      process stages of bitonic sort from (k, j) to the end.
+     *             the depth of recursion is O(log^2 n).
+     * @param[in]  init: registered pairs.
+     * @param[in]  a: order before the stage.
+     * @param[in]  k: size of bitonic sequences, which are merged in the stage.
+     * @param[in]  j: distance of compared elements.
+     * @param[in]  tag: compile switcher of dataset.
+     * @return     sorted order.
+     */
+    template <typename TAG>
+    static constexpr order_array sort_from(const value_type (&init)[N], const order_array& a, std::size_t k, std::size_t j, TAG tag)
+    {
+        return (k > padded_size) ? a
+             : sort_from(init, stage(init, a, k, j, tag, biconv_detail::make_index_sequence<padded_size>{}),
+                         (j == 1) ? (k * 2) : k, (j == 1) ? k : (j / 2), tag);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get initial order, which is padded by N.
+     * @param[in]  dummy: positions of order.
+     * @return     {0, 1, ..., N - 1, N, ..., N}
+     */
+    template <std::size_t... Is>
+    static constexpr order_array identity(biconv_detail::index_sequence<Is...> dummy)
+    {
+        return order_array{{((Is < N) ? Is : N)...}};
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      sort indexes of pairs by bitonic sorting network. it costs
+     *             O(n log^2 n) in compile time.
+     * @param[in]  init: registered pairs.
+     * @param[in]  tag: compile switcher of dataset.
+     * @return     sorted order. first N elements are indexes of pairs.
+     */
+    template <typename TAG>
+    static constexpr order_array sort(const value_type (&init)[N], TAG tag)
+    {
+        return sort_from(init, identity(biconv_detail::make_index_sequence<padded_size>{}), 2, 1, tag);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get index of pair in sorted order.
+     * @param[in]  k: position in sorted order.
+     * @param[in]  tag: compile switcher. in this case, first.
+     * @return     index of values_.
+     */
+    constexpr std::size_t order(std::size_t k, first_tag tag) const
+    {
+        return f_order_[k];
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get index of pair in sorted order.
+     * @param[in]  k: position in sorted order.
+     * @param[in]  tag: compile switcher. in this case, second.
+     * @return     index of values_.
+     */
+    constexpr std::size_t order(std::size_t k, second_tag tag) const
+    {
+        return s_order_[k];
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      find first position in [first, last) of sorted order,
+     *             which is not less than element.
+     * @param[in]  element: appointed element of dataset.
+     * @param[in]  first: first position.
+     * @param[in]  last: last position.
+     * @param[in]  tag: compile switcher of dataset.
+     * @return     position in sorted order.
+     */
+    template <typename T, typename TAG>
+    constexpr std::size_t lower_bound(const T& element, std::size_t first, std::size_t last, TAG tag) const
+    {
+        return (first == last) ? first
+             : (get(values_[order(first + (last - first) / 2, tag)], tag) < element)
+               ? lower_bound(element, first + (last - first) / 2 + 1, last, tag)
+               : lower_bound(element, first, first + (last - first) / 2, tag);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      check position found by lower_bound().
+     * @param[in]  element: appointed element of dataset.
+     * @param[in]  k: position in sorted order.
+     * @param[in]  tag: compile switcher of dataset.
+     * @return     index of values_. N if not found.
+     */
+    template <typename T, typename TAG>
+    constexpr std::size_t found(const T& element, std::size_t k, TAG tag) const
+    {
+        return ((k < N) && (get(values_[order(k, tag)], tag) == element)) ? order(k, tag) : N;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      find element in dataset by binary search.
+     * @param[in]  element: appointed element of dataset.
+     * @param[in]  tag: compile switcher of dataset.
+     * @return     index of values_. N if not found.
+     */
+    template <typename T, typename TAG>
+    constexpr std::size_t find(const T& element, TAG tag) const
+    {
+        return found(element, lower_bound(element, 0, N, tag), tag);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get first of found pair.
+     * @param[in]  i: index of values_.
+     * @return     values_[i].first
+     * @throw      std::out_of_range: if i is N.
+     */
+    constexpr F first_at(std::size_t i) const
+    {
+        return (i < N) ? values_[i].first : throw std::out_of_range("static_biconv::rconvert()");
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get second of found pair.
+     * @param[in]  i: index of values_.
+     * @return     values_[i].second
+     * @throw      std::out_of_range: if i is N.
+     */
+    constexpr S second_at(std::size_t i) const
+    {
+        return (i < N) ? values_[i].second : throw std::out_of_range("static_biconv::convert()");
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get first of found pair, or default value.
+     * @param[in]  i: index of values_.
+     * @param[in]  defaultF: returned value if i is N.
+     * @return     values_[i].first or defaultF.
+     */
+    constexpr F first_or(std::size_t i, const F& defaultF) const
+    {
+        return (i < N) ? values_[i].first : defaultF;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get second of found pair, or default value.
+     * @param[in]  i: index of values_.
+     * @param[in]  defaultS: returned value if i is N.
+     * @return     values_[i].second or defaultS.
+     */
+    constexpr S second_or(std::size_t i, const S& defaultS) const
+    {
+        return (i < N) ? values_[i].second : defaultS;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    const value_type values_[N];     // registered datasets
+    const std::size_t f_order_[N];   // indexes of values_ in order of first
+    const std::size_t s_order_[N];   // indexes of values_ in order of second
+    /////////////////////////////////////////////////////////////////////////////
+
+};
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace ken3 {
+
+#endif // #ifndef INCLUDE_GUARD_KEN3_BICONV_STATIC_HPP
@@ -18,15 +18,45 @@
  * biunique means, both key value and mapped value are unique.
  *     ken3::biunique_map<char, int> bm{{'A', 10}, {'A', 11}}; // not allowed
  *     ken3::biunique_map<char, int> bm{{'A', 10}, {'B', 10}}; // not allowed
+ *
+ * biunique_map keeps a reverse index from mapped value to key value, thus
+ * s2f(), has_s(), and erase_by_s() cost the same as f2s(), has_f(), and
+ * erase_by_f(). mapped value needs operator< for ordered types, and
+ * std::hash for unordered_no_default, as same as key value.
+ *
+ * flat_no_default keeps data in two sorted std::vector instead of tree
+ * nodes. it is suitable for a map which is built once and read many times.
+ * use reserve() and bulk insert() or assign(), because inserting one item
+ * costs O(n) in this type.
+ *     ken3::biunique_map<int, std::string, ken3::biunique_map_type::flat_no_default> bm;
+ *     bm.assign(pairs.begin(), pairs.end()); // sorted at once
+ *
+ * Allocator is rebound for both of map and reverse index, and also for
+ * temporary containers of bulk insert. thus, all memory of biunique_map
+ * comes from Allocator. with C++17, ken3::pmr::biunique_map uses
+ * std::pmr::polymorphic_allocator.
+ *     std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+ *     ken3::pmr::biunique_map<int, int> bm(&arena);
  */
 
 #ifndef INCLUDE_GUARD_KEN3_BIUNIQUE_MAP_HPP
 #define INCLUDE_GUARD_KEN3_BIUNIQUE_MAP_HPP
 
+#include <algorithm>
+#include <iterator>
+#include <functional>
 #include <map>
+#include <memory>
+#include <set>
 #include <stdexcept>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 namespace ken3 {
 
@@ -41,6 +71,8 @@ namespace ken3 {
  *                                s2f() tries to find default value from back of std::map.
  *          unordered_no_default: biunique_map uses std::unordered_map for container. f2s()
  *                                or s2f() may throw out_of_range.
+ *          flat_no_default: biunique_map uses sorted std::vector for container. f2s()
+ *                           or s2f() may throw out_of_range.
  */
 enum class biunique_map_type
 {
@@ -48,6 +80,7 @@ enum class biunique_map_type
     ordered_front_default,
     ordered_back_default,
     unordered_no_default,
+    flat_no_default,
 };
 /////////////////////////////////////////////////////////////////////////////
 
@@ -64,6 +97,478 @@ enum class biunique_map_policy
 };
 /////////////////////////////////////////////////////////////////////////////
 
+namespace biunique_map_detail {
+
+/**
+ * @class   flat_map
+ * @brief   A map class on sorted std::vector. it has a subset of std::map
+ *          interfaces, which is used by biunique_map.
+ * @tparam  K: key type.
+ * @tparam  V: mapped type.
+ * @tparam  A: allocator of std::pair<K, V>.
+ */
+template <typename K, typename V, typename A = std::allocator<std::pair<K, V>>>
+class flat_map
+{
+public:
+    // type definitions
+    using key_type               = K;
+    using mapped_type            = V;
+    using value_type             = std::pair<K, V>;
+    using allocator_type         = A;
+    using container_type         = std::vector<value_type, A>;
+    using size_type              = typename container_type::size_type;
+    using iterator               = typename container_type::iterator;
+    using const_iterator         = typename container_type::const_iterator;
+    using const_reverse_iterator = typename container_type::const_reverse_iterator;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      default-constructor, copy-constructor, move-constructor, destructor,
+     *             copy-operator=, and move-operator= are default.
+     */
+    flat_map(void) = default;
+    flat_map(const flat_map& src) = default;
+    flat_map(flat_map&& src) = default;
+    flat_map& operator=(const flat_map& rhs) = default;
+    flat_map& operator=(flat_map&& rhs) = default;
+    ~flat_map(void) = default;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with allocator.
+     * @param[in]  alloc: allocator
+     */
+    explicit flat_map(const allocator_type& alloc) :
+        data_(alloc)
+    {
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with initializer_list. if keys are duplex,
+     *             the first one is kept as same as std::map.
+     * @param[in]  init: source of constructor
+     */
+    flat_map(std::initializer_list<value_type> init) :
+        data_(init)
+    {
+        std::stable_sort(data_.begin(), data_.end(), less_item);
+        auto same = [](const value_type& lhs, const value_type& rhs) -> bool {
+            return !(lhs.first < rhs.first);
+        };
+        data_.erase(std::unique(data_.begin(), data_.end(), same), data_.end());
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get size.
+     * @return     size of map.
+     */
+    size_type size(void) const noexcept
+    {
+        return data_.size();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get empty or not.
+     * @return     true: empty, false: not empty
+     */
+    bool empty(void) const noexcept
+    {
+        return data_.empty();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get begin iterator.
+     * @return     begin
+     */
+    iterator begin(void) noexcept
+    {
+        return data_.begin();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get end iterator.
+     * @return     end
+     */
+    iterator end(void) noexcept
+    {
+        return data_.end();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get begin iterator.
+     * @return     begin
+     */
+    const_iterator begin(void) const noexcept
+    {
+        return data_.cbegin();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get end iterator.
+     * @return     end
+     */
+    const_iterator end(void) const noexcept
+    {
+        return data_.cend();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get begin iterator.
+     * @return     begin
+     */
+    const_iterator cbegin(void) const noexcept
+    {
+        return data_.cbegin();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get end iterator.
+     * @return     end
+     */
+    const_iterator cend(void) const noexcept
+    {
+        return data_.cend();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get reverse begin iterator.
+     * @return     reverse begin
+     */
+    const_reverse_iterator crbegin(void) const noexcept
+    {
+        return data_.crbegin();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get reverse end iterator.
+     * @return     reverse end
+     */
+    const_reverse_iterator crend(void) const noexcept
+    {
+        return data_.crend();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get allocator.
+     * @return     allocator
+     */
+    allocator_type get_allocator(void) const
+    {
+        return data_.get_allocator();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      clear all data
+     */
+    void clear(void) noexcept
+    {
+        data_.clear();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      swap with another
+     * @param[in,out] rhs: right hand side of swap
+     */
+    void swap(flat_map& rhs) noexcept
+    {
+        data_.swap(rhs.data_);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      reserve capacity for n items.
+     * @param[in]  n: the number of items.
+     */
+    void reserve(size_type n)
+    {
+        data_.reserve(n);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      find key by binary search.
+     * @param[in]  k: key to be found.
+     * @return     iterator of found item. end() if not found.
+     */
+    iterator find(const K& k)
+    {
+        auto i = std::lower_bound(data_.begin(), data_.end(), k, less_key);
+        return ((i != data_.end()) && !(k < i->first)) ? i : data_.end();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      find key by binary search.
+     * @param[in]  k: key to be found.
+     * @return     iterator of found item. cend() if not found.
+     */
+    const_iterator find(const K& k) const
+    {
+        auto i = std::lower_bound(data_.cbegin(), data_.cend(), k, less_key);
+        return ((i != data_.cend()) && !(k < i->first)) ? i : data_.cend();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      find the first item, whose key is not less than k.
+     * @param[in]  k: key to be found.
+     * @return     iterator of found item. cend() if all keys are less than k.
+     */
+    const_iterator lower_bound(const K& k) const
+    {
+        return std::lower_bound(data_.cbegin(), data_.cend(), k, less_key);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      insert one item. it costs O(n).
+     * @param[in]  v: item to be inserted.
+     * @return     iterator of the item, and true if inserted.
+     */
+    std::pair<iterator, bool> insert(const value_type& v)
+    {
+        auto i = std::lower_bound(data_.begin(), data_.end(), v.first, less_key);
+        if ((i != data_.end()) && !(v.first < i->first)) {
+            return std::make_pair(i, false);
+        }
+        return std::make_pair(data_.insert(i, v), true);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      insert one item. it costs O(n).
+     * @param[in]  k: key to be inserted.
+     * @param[in]  v: mapped value to be inserted.
+     * @return     iterator of the item, and true if inserted.
+     */
+    std::pair<iterator, bool> emplace(const K& k, const V& v)
+    {
+        return insert(value_type(k, v));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      erase one item.
+     * @param[in]  i: iterator of item to be erased.
+     * @return     iterator following the erased item.
+     */
+    iterator erase(const_iterator i)
+    {
+        return data_.erase(i);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      erase one item by key.
+     * @param[in]  k: key to be erased.
+     * @return     the number of erased items.
+     */
+    size_type erase(const K& k)
+    {
+        auto i = find(k);
+        if (i == data_.end()) {
+            return 0;
+        }
+        data_.erase(i);
+        return 1;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      merge items, which are sorted at once.
+     * @param[in]  items: items whose keys are unique and not registered.
+     * @return     merged map. *this is not changed.
+     */
+    flat_map merged(container_type items) const
+    {
+        std::sort(items.begin(), items.end(), less_item);
+
+        flat_map m(data_.get_allocator());
+        m.data_.reserve(std::max(data_.capacity(), data_.size() + items.size()));
+        std::merge(data_.cbegin(), data_.cend(), std::make_move_iterator(items.begin()),
+                   std::make_move_iterator(items.end()), std::back_inserter(m.data_), less_item);
+        return m;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    /**
+     * @brief      compare keys of items.
+     * @param[in]  lhs: left hand side.
+     * @param[in]  rhs: right hand side.
+     * @return     lhs.first < rhs.first
+     */
+    static bool less_item(const value_type& lhs, const value_type& rhs)
+    {
+        return lhs.first < rhs.first;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      compare key of item with key.
+     * @param[in]  lhs: left hand side.
+     * @param[in]  rhs: right hand side.
+     * @return     lhs.first < rhs
+     */
+    static bool less_key(const value_type& lhs, const K& rhs)
+    {
+        return lhs.first < rhs;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    container_type data_; // sorted by key
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      allocator type, which is rebound from A for T.
+ * @tparam     A: source allocator
+ * @tparam     T: value type
+ */
+template <typename A, typename T>
+using rebind_alloc = typename std::allocator_traits<A>::template rebind_alloc<T>;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      reserve capacity of container if it supports reserve().
+ * @param[in,out] c: container
+ * @param[in]  n: capacity
+ * @param[in]  dummy: compile switcher. int is preferred to long.
+ */
+template <typename C>
+auto reserve(C& c, std::size_t n, int dummy) -> decltype(c.reserve(n), void())
+{
+    c.reserve(n);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      reserve capacity of container if it supports reserve().
+ *             this overload is for containers without reserve().
+ * @param[in,out] c: container
+ * @param[in]  n: capacity
+ * @param[in]  dummy: compile switcher.
+ */
+template <typename C>
+void reserve(C& c, std::size_t n, long dummy)
+{
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   minimum size of batches and maps, which are looked up in sorted order.
+ *          smaller ones are looked up one by one, because they stay in cache.
+ */
+constexpr std::size_t batch_threshold = 1024;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   a batch is looked up in sorted order if it has one key per this
+ *          number of items of map, at least. sparse keys are rarely found by
+ *          walking, thus sorting them costs more than it saves.
+ */
+constexpr std::size_t batch_density = 32;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   the number of items, which a sorted lookup walks from the previous
+ *          found item before it searches from the root.
+ */
+constexpr std::size_t batch_walk = 8;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   minimum size of chunks, which a thread converts.
+ */
+constexpr std::size_t parallel_chunk = 16384;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      find keys of a batch in a sorted map. keys are visited in sorted
+ *             order, thus a key near the previous one is found by walking a
+ *             few items, and the path from the root stays in cache.
+ *             temporary containers use the allocator of map.
+ * @param[in]  m: std::map or flat_map.
+ * @param[in]  first: first forward iterator of keys.
+ * @param[in]  last: last forward iterator of keys.
+ * @return     pointers to mapped values in order of keys. nullptr if not found.
+ */
+template <typename M, typename ForwardIt>
+std::vector<const typename M::mapped_type*, rebind_alloc<typename M::allocator_type, const typename M::mapped_type*>>
+find_sorted(const M& m, ForwardIt first, ForwardIt last)
+{
+    using key_type = typename M::key_type;
+    using found_type = const typename M::mapped_type*;
+    using item_type = std::pair<const key_type*, std::size_t>;
+    std::vector<item_type, rebind_alloc<typename M::allocator_type, item_type>> keys(m.get_allocator());
+    keys.reserve(static_cast<std::size_t>(std::distance(first, last)));
+    for (auto i = first; i != last; ++i) {
+        keys.emplace_back(&*i, keys.size());
+    }
+    std::sort(keys.begin(), keys.end(), [](const item_type& lhs, const item_type& rhs) {
+        return *lhs.first < *rhs.first;
+    });
+    std::vector<found_type, rebind_alloc<typename M::allocator_type, found_type>> found(keys.size(), nullptr, m.get_allocator());
+    auto j = m.begin();
+    for (const auto& i: keys) {
+        const key_type& k = *i.first;
+        for (std::size_t step = 0; (j != m.end()) && (j->first < k); step++) {
+            if (step == batch_walk) {
+                j = m.lower_bound(k);
+                break;
+            }
+            ++j;
+        }
+        if ((j != m.end()) && !(k < j->first)) {
+            found[i.second] = &j->second;
+        }
+    }
+    return found;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      split a batch into chunks, and convert them by thread pool.
+ * @param[in]  pool: thread pool, which has size() and parallel_for(n, func)
+ *             as same as ken3::pystr::parallel::thread_pool.
+ * @param[in]  first: first random access iterator of source values.
+ * @param[in]  last: last random access iterator of source values.
+ * @param[out] out: random access iterator of converted values.
+ * @param[in]  func: converter of a chunk, which is called as func(first, last, out).
+ * @return     output iterator after the last converted value.
+ */
+template <typename Pool, typename RandomIt, typename OutputIt, typename Func>
+OutputIt parallel_many(Pool& pool, RandomIt first, RandomIt last, OutputIt out, Func func)
+{
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    const std::size_t chunks = std::max<std::size_t>(1, std::min<std::size_t>(pool.size() + 1, n / parallel_chunk));
+    pool.parallel_for(chunks, [&](std::size_t c) {
+        const std::size_t begin = (n / chunks) * c + std::min(c, n % chunks);
+        const std::size_t end = (n / chunks) * (c + 1) + std::min(c + 1, n % chunks);
+        func(first + begin, first + end, out + begin);
+    });
+    return out + n;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace biunique_map_detail {
+
 /**
  * @class   biunique_map
  * @brief   A map class, which handles biunique key and value.
@@ -74,8 +579,11 @@ enum class biunique_map_policy
  * @tparam  S: mapped type of biunique_map.
  * @tparam  TYPE: biunique_map_type. default is ordered_no_default.
  * @tparam  POLICY: biunique_map_policy. default silence. 
+ * @tparam  Allocator: allocator of std::pair<const F, S>. it is rebound for
+ *                     all containers in biunique_map.
  */
-template <typename F, typename S, biunique_map_type TYPE=biunique_map_type::ordered_no_default, biunique_map_policy POLICY=biunique_map_policy::silence>
+template <typename F, typename S, biunique_map_type TYPE=biunique_map_type::ordered_no_default, biunique_map_policy POLICY=biunique_map_policy::silence,
+          typename Allocator=std::allocator<std::pair<const F, S>>>
 class biunique_map
 {
     // static_asserts
@@ -83,7 +591,8 @@ class biunique_map
         TYPE == biunique_map_type::ordered_no_default ||
         TYPE == biunique_map_type::ordered_front_default ||
         TYPE == biunique_map_type::ordered_back_default ||
-        TYPE == biunique_map_type::unordered_no_default,
+        TYPE == biunique_map_type::unordered_no_default ||
+        TYPE == biunique_map_type::flat_no_default,
         "unknown type for biunique_map"
     );
     static_assert(
@@ -95,24 +604,51 @@ class biunique_map
 
 public:
     // type definitions
-    using map_type       = typename std::conditional<TYPE == biunique_map_type::unordered_no_default, std::unordered_map<F, S>, std::map<F, S>>::type;
+    template <typename T>
+    using alloc_of       = biunique_map_detail::rebind_alloc<Allocator, T>;
+    using allocator_type = Allocator;
+    using map_type       = typename std::conditional<TYPE == biunique_map_type::unordered_no_default,
+                           std::unordered_map<F, S, std::hash<F>, std::equal_to<F>, alloc_of<std::pair<const F, S>>>,
+                           typename std::conditional<TYPE == biunique_map_type::flat_no_default,
+                           biunique_map_detail::flat_map<F, S, alloc_of<std::pair<F, S>>>,
+                           std::map<F, S, std::less<F>, alloc_of<std::pair<const F, S>>>>::type>::type;
+    using rmap_type      = typename std::conditional<TYPE == biunique_map_type::unordered_no_default,
+                           std::unordered_map<S, F, std::hash<S>, std::equal_to<S>, alloc_of<std::pair<const S, F>>>,
+                           typename std::conditional<TYPE == biunique_map_type::flat_no_default,
+                           biunique_map_detail::flat_map<S, F, alloc_of<std::pair<S, F>>>,
+                           std::map<S, F, std::less<S>, alloc_of<std::pair<const S, F>>>>::type>::type;
     using key_type       = typename map_type::key_type;
     using mapped_type    = typename map_type::mapped_type;
     using value_type     = typename map_type::value_type;
     using size_type      = typename map_type::size_type;
     using const_iterator = typename map_type::const_iterator;
 private:
-    using self_type      = biunique_map<F, S, TYPE, POLICY>;
+    using self_type      = biunique_map<F, S, TYPE, POLICY, Allocator>;
     template <biunique_map_type BMT, typename V = void> struct sType;
     template <biunique_map_type BMT> struct sType<BMT, typename std::enable_if<BMT == biunique_map_type::ordered_no_default>::type> {};
     template <biunique_map_type BMT> struct sType<BMT, typename std::enable_if<BMT == biunique_map_type::ordered_front_default>::type> {};
     template <biunique_map_type BMT> struct sType<BMT, typename std::enable_if<BMT == biunique_map_type::ordered_back_default>::type> {};
     template <biunique_map_type BMT> struct sType<BMT, typename std::enable_if<BMT == biunique_map_type::unordered_no_default>::type> {};
+    template <biunique_map_type BMT> struct sType<BMT, typename std::enable_if<BMT == biunique_map_type::flat_no_default>::type> {};
     template <biunique_map_policy BMP, typename V = void> struct sPolicy;
     template <biunique_map_policy BMP> struct sPolicy<BMP, typename std::enable_if<BMP == biunique_map_policy::silence>::type> {};
     template <biunique_map_policy BMP> struct sPolicy<BMP, typename std::enable_if<BMP == biunique_map_policy::throwing>::type> {};
     using my_type        = sType<TYPE>;
     using my_policy      = sPolicy<POLICY>;
+    using is_flat        = std::integral_constant<bool, TYPE == biunique_map_type::flat_no_default>;
+    template <typename It, typename K>
+    using is_batch       = std::integral_constant<bool, TYPE != biunique_map_type::unordered_no_default &&
+                           std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>::value &&
+                           std::is_reference<typename std::iterator_traits<It>::reference>::value &&
+                           std::is_same<typename std::iterator_traits<It>::value_type, K>::value>;
+    using fset_type      = typename std::conditional<TYPE == biunique_map_type::unordered_no_default,
+                           std::unordered_set<F, std::hash<F>, std::equal_to<F>, alloc_of<F>>,
+                           std::set<F, std::less<F>, alloc_of<F>>>::type;
+    using sset_type      = typename std::conditional<TYPE == biunique_map_type::unordered_no_default,
+                           std::unordered_set<S, std::hash<S>, std::equal_to<S>, alloc_of<S>>,
+                           std::set<S, std::less<S>, alloc_of<S>>>::type;
+    using items_type     = std::vector<value_type, alloc_of<value_type>>;
+    using ritems_type    = std::vector<typename rmap_type::value_type, alloc_of<typename rmap_type::value_type>>;
     /////////////////////////////////////////////////////////////////////////////
 
 public:
@@ -128,13 +664,26 @@ public:
     ~biunique_map(void) = default;
     /////////////////////////////////////////////////////////////////////////////
 
+    /**
+     * @brief      constructor with allocator.
+     * @param[in]  alloc: allocator
+     */
+    explicit biunique_map(const allocator_type& alloc) :
+        m_(typename map_type::allocator_type(alloc)),
+        r_(typename rmap_type::allocator_type(alloc))
+    {
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
     /**
      * @brief      iterator constructor.
      * @param[in]  first: first iterator
      * @param[in]  last: last iterator
+     * @param[in]  alloc: allocator
      */
     template <typename InputIt>
-    biunique_map(InputIt first, InputIt last)
+    biunique_map(InputIt first, InputIt last, const allocator_type& alloc = allocator_type()) :
+        biunique_map(alloc)
     {
         insert_impl(first, last, false, my_policy{});
     }
@@ -146,8 +695,10 @@ public:
      * @note       if init includes duplex value,
      *             - duplex value is ignored if POLICY is Silence.
      *             - invalid_argument is thrown if POLICY is Throwing.
+     * @param[in]  alloc: allocator
      */
-    biunique_map(std::initializer_list<value_type> init)
+    biunique_map(std::initializer_list<value_type> init, const allocator_type& alloc = allocator_type()) :
+        biunique_map(alloc)
     {
         insert_impl(init.begin(), init.end(), false, my_policy{});
     }
@@ -163,7 +714,7 @@ public:
      */
     self_type& operator=(std::initializer_list<value_type> init)
     {
-        operator=(biunique_map{init});
+        operator=(self_type(init, get_allocator()));
         return *this;
     }
     /////////////////////////////////////////////////////////////////////////////
@@ -205,10 +756,22 @@ public:
     /**
      * @brief      swap with another
      * @param[in,out] rhs: right hand side of swap
+     * @note       allocators shall be equal, unless they propagate on swap.
      */
     void swap(self_type& rhs) noexcept
     {
         m_.swap(rhs.m_);
+        r_.swap(rhs.r_);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get allocator.
+     * @return     allocator, which is given at construction.
+     */
+    allocator_type get_allocator(void) const
+    {
+        return allocator_type(m_.get_allocator());
     }
     /////////////////////////////////////////////////////////////////////////////
 
@@ -260,6 +823,48 @@ public:
     void clear(void) noexcept
     {
         m_.clear();
+        r_.clear();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      reserve capacity for n items.
+     * @param[in]  n: the number of items.
+     * @note       nothing happens if TYPE uses std::map.
+     */
+    void reserve(size_type n)
+    {
+        biunique_map_detail::reserve(m_, n, 0);
+        biunique_map_detail::reserve(r_, n, 0);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      replace all data by items of iterator.
+     *             if TYPE is flat_no_default, items are sorted at once.
+     * @param[in]  first: first iterator
+     * @param[in]  last: last iterator
+     * @note       if items include duplex value,
+     *             - duplex value is ignored if POLICY is Silence.
+     *             - invalid_argument is thrown if POLICY is Throwing, and
+     *               data are not changed.
+     */
+    template <typename InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        self_type m(first, last, get_allocator());
+        swap(m);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      replace all data by initializer_list.
+     * @param[in]  init: source of data
+     * @note       same as assign(init.begin(), init.end()).
+     */
+    void assign(std::initializer_list<value_type> init)
+    {
+        assign(init.begin(), init.end());
     }
     /////////////////////////////////////////////////////////////////////////////
 
@@ -350,10 +955,7 @@ public:
      */
     bool has_s(const S& s) const
     {
-        auto pred = [&s](const value_type& i) -> bool {
-            return s == i.second;
-        };
-        return std::any_of(m_.begin(), m_.end(), pred);
+        return r_.find(s) != r_.cend();
     }
     /////////////////////////////////////////////////////////////////////////////
 
@@ -364,7 +966,11 @@ public:
      */
     void erase_by_f(const F& f)
     {
-        m_.erase(f);
+        auto i = m_.find(f);
+        if (i != m_.end()) {
+            r_.erase(i->second);
+            m_.erase(i);
+        }
     }
     /////////////////////////////////////////////////////////////////////////////
 
@@ -375,11 +981,10 @@ public:
      */
     void erase_by_s(const S& s)
     {
-        for (const auto& i: m_) {
-            if (s == i.second) {
-                m_.erase(i.first);
-                break;
-            }
+        auto i = r_.find(s);
+        if (i != r_.end()) {
+            m_.erase(i->second);
+            r_.erase(i);
         }
     }
     /////////////////////////////////////////////////////////////////////////////
@@ -428,16 +1033,190 @@ public:
      */
     const F& s2f(const S& s) const
     {
-        for (const auto& i: m_) {
-            if (s == i.second) {
-                return i.first;
-            }
+        auto i = r_.find(s);
+        if (i != r_.cend()) {
+            return i->second;
         }
         return throw_or_default<true>(my_type{});
     }
     /////////////////////////////////////////////////////////////////////////////
 
+    /**
+     * @brief      convert key values to mapped values in a batch.
+     * @param[in]  first: first iterator of key values.
+     * @param[in]  last: last iterator of key values.
+     * @param[out] out: output iterator of mapped values.
+     * @return     output iterator after the last converted value.
+     * @note       same as f2s() about not found key value. if an exception
+     *             is thrown, values before it are already written.
+     *             ordered and flat maps look up a large and dense batch of
+     *             forward iterators in sorted order of keys.
+     */
+    template <typename InputIt, typename OutputIt>
+    OutputIt f2s_many(InputIt first, InputIt last, OutputIt out) const
+    {
+        return convert_many<false>(m_, first, last, out, nullptr, is_batch<InputIt, F>{});
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert key values to mapped values in a batch.
+     *             this function never throws exceptions of not found.
+     * @param[in]  first: first iterator of key values.
+     * @param[in]  last: last iterator of key values.
+     * @param[out] out: output iterator of mapped values.
+     * @param[in]  defaultS: written value if key value is not found.
+     * @return     output iterator after the last converted value.
+     */
+    template <typename InputIt, typename OutputIt>
+    OutputIt f2s_many(InputIt first, InputIt last, OutputIt out, const S& defaultS) const
+    {
+        return convert_many<false>(m_, first, last, out, &defaultS, is_batch<InputIt, F>{});
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert key values to mapped values in a batch by threads.
+     *             the batch is split into chunks for each thread of pool.
+     * @param[in]  pool: thread pool, which has size() and parallel_for(n, func)
+     *             as same as ken3::pystr::parallel::thread_pool.
+     * @param[in]  first: first random access iterator of key values.
+     * @param[in]  last: last random access iterator of key values.
+     * @param[out] out: random access iterator of mapped values.
+     * @param[in]  defaultS: written value if key value is not found.
+     * @return     output iterator after the last converted value.
+     */
+    template <typename Pool, typename RandomIt, typename OutputIt>
+    OutputIt f2s_many(Pool& pool, RandomIt first, RandomIt last, OutputIt out, const S& defaultS) const
+    {
+        return biunique_map_detail::parallel_many(pool, first, last, out, [this, &defaultS](RandomIt f, RandomIt l, OutputIt o) {
+            f2s_many(f, l, o, defaultS);
+        });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert mapped values to key values in a batch.
+     * @param[in]  first: first iterator of mapped values.
+     * @param[in]  last: last iterator of mapped values.
+     * @param[out] out: output iterator of key values.
+     * @return     output iterator after the last converted value.
+     * @note       same as s2f() about not found mapped value. if an exception
+     *             is thrown, values before it are already written.
+     *             ordered and flat maps look up a large and dense batch of
+     *             forward iterators in sorted order of mapped values.
+     */
+    template <typename InputIt, typename OutputIt>
+    OutputIt s2f_many(InputIt first, InputIt last, OutputIt out) const
+    {
+        return convert_many<true>(r_, first, last, out, nullptr, is_batch<InputIt, S>{});
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert mapped values to key values in a batch.
+     *             this function never throws exceptions of not found.
+     * @param[in]  first: first iterator of mapped values.
+     * @param[in]  last: last iterator of mapped values.
+     * @param[out] out: output iterator of key values.
+     * @param[in]  defaultF: written value if mapped value is not found.
+     * @return     output iterator after the last converted value.
+     */
+    template <typename InputIt, typename OutputIt>
+    OutputIt s2f_many(InputIt first, InputIt last, OutputIt out, const F& defaultF) const
+    {
+        return convert_many<true>(r_, first, last, out, &defaultF, is_batch<InputIt, S>{});
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert mapped values to key values in a batch by threads.
+     *             the batch is split into chunks for each thread of pool.
+     * @param[in]  pool: thread pool, which has size() and parallel_for(n, func)
+     *             as same as ken3::pystr::parallel::thread_pool.
+     * @param[in]  first: first random access iterator of mapped values.
+     * @param[in]  last: last random access iterator of mapped values.
+     * @param[out] out: random access iterator of key values.
+     * @param[in]  defaultF: written value if mapped value is not found.
+     * @return     output iterator after the last converted value.
+     */
+    template <typename Pool, typename RandomIt, typename OutputIt>
+    OutputIt s2f_many(Pool& pool, RandomIt first, RandomIt last, OutputIt out, const F& defaultF) const
+    {
+        return biunique_map_detail::parallel_many(pool, first, last, out, [this, &defaultF](RandomIt f, RandomIt l, OutputIt o) {
+            s2f_many(f, l, o, defaultF);
+        });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
 private:
+    /**
+     * @brief      convert values in a batch one by one.
+     * @tparam     FIRST: if true, convert to first. else, convert to second.
+     * @param[in]  m: m_ or r_.
+     * @param[in]  first: first iterator of source values.
+     * @param[in]  last: last iterator of source values.
+     * @param[out] out: output iterator of converted values.
+     * @param[in]  defaultV: written value if not found. nullptr means same as f2s() or s2f().
+     * @param[in]  dummy: compile switcher. in this case, the batch is not sorted.
+     * @return     output iterator after the last converted value.
+     */
+    template <bool FIRST, typename M, typename InputIt, typename OutputIt>
+    OutputIt convert_many(const M& m, InputIt first, InputIt last, OutputIt out,
+                          const typename M::mapped_type* defaultV, std::false_type dummy) const
+    {
+        for (auto i = first; i != last; ++i, ++out) {
+            auto j = m.find(*i);
+            *out = (j != m.cend()) ? j->second : not_found<FIRST>(defaultV);
+        }
+        return out;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert values in a batch. a large and dense batch is looked up
+     *             in sorted order.
+     * @tparam     FIRST: if true, convert to first. else, convert to second.
+     * @param[in]  m: m_ or r_.
+     * @param[in]  first: first forward iterator of source values.
+     * @param[in]  last: last forward iterator of source values.
+     * @param[out] out: output iterator of converted values.
+     * @param[in]  defaultV: written value if not found. nullptr means same as f2s() or s2f().
+     * @param[in]  dummy: compile switcher. in this case, the batch may be sorted.
+     * @return     output iterator after the last converted value.
+     */
+    template <bool FIRST, typename M, typename ForwardIt, typename OutputIt>
+    OutputIt convert_many(const M& m, ForwardIt first, ForwardIt last, OutputIt out,
+                          const typename M::mapped_type* defaultV, std::true_type dummy) const
+    {
+        const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+        if ((n < biunique_map_detail::batch_threshold) || (m.size() < biunique_map_detail::batch_threshold) ||
+            (n * biunique_map_detail::batch_density < m.size())) {
+            return convert_many<FIRST>(m, first, last, out, defaultV, std::false_type{});
+        }
+        for (auto i: biunique_map_detail::find_sorted(m, first, last)) {
+            *out = (i != nullptr) ? *i : not_found<FIRST>(defaultV);
+            ++out;
+        }
+        return out;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get converted value when source value is not found.
+     * @tparam     FIRST: if true, get first. else, get second.
+     * @param[in]  defaultV: default value. nullptr means same as f2s() or s2f().
+     * @return     defaultV or value of throw_or_default().
+     * @throw      std::out_of_range: same as throw_or_default().
+     */
+    template <bool FIRST>
+    typename std::conditional<FIRST, const F&, const S&>::type not_found(
+        const typename std::conditional<FIRST, F, S>::type* defaultV) const
+    {
+        return (defaultV != nullptr) ? *defaultV : throw_or_default<FIRST>(my_type{});
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
     /**
      * @brief      process to get value when appointed key is not found.
      * @tparam     FIRST: if true, get first. else, get second.
@@ -500,6 +1279,20 @@ private:
     }
     /////////////////////////////////////////////////////////////////////////////
 
+    /**
+     * @brief      process to get value when appointed key is not found.
+     * @tparam     FIRST: if true, get first. else, get second.
+     * @param[in]  dummy: compile switcher. in this case, TYPE == flat_no_default.
+     * @return     never returns. always throw std::out_of_range
+     * @throw      std::out_of_range: always.
+     */
+    template <bool FIRST>
+    typename std::conditional<FIRST, const F&, const S&>::type throw_or_default(sType<biunique_map_type::flat_no_default> dummy) const
+    {
+        throw std::out_of_range("");
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
     /**
      * @brief      process to insert items.
      * @tparam     InputIt: iterator type.
@@ -511,15 +1304,58 @@ private:
      */
     template <typename InputIt>
     void insert_impl(InputIt first, InputIt last, bool self, sPolicy<biunique_map_policy::silence> dummy)
+    {
+        insert_silence(first, last, is_flat{});
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      process to insert items with silence policy.
+     * @tparam     InputIt: iterator type.
+     * @param[in]  first: first iterator
+     * @param[in]  last: last iterator
+     * @param[in]  dummy: compile switcher. in this case, TYPE is not flat_no_default.
+     */
+    template <typename InputIt>
+    void insert_silence(InputIt first, InputIt last, std::false_type dummy)
     {
         for (auto i = first; i != last; ++i) {
             if (!has_f(i->first) && !has_s(i->second)) {
-                m_.insert(*i);
+                insert_item(*i);
             } 
        }
     }
     /////////////////////////////////////////////////////////////////////////////
 
+    /**
+     * @brief      process to insert items with silence policy.
+     *             accepted items are collected, and merged at once.
+     * @tparam     InputIt: iterator type.
+     * @param[in]  first: first iterator
+     * @param[in]  last: last iterator
+     * @param[in]  dummy: compile switcher. in this case, TYPE == flat_no_default.
+     */
+    template <typename InputIt>
+    void insert_silence(InputIt first, InputIt last, std::true_type dummy)
+    {
+        items_type items(get_allocator());
+        fset_type fs(get_allocator());
+        sset_type ss(get_allocator());
+        const bool single = (first == last) || (std::next(first) == last);
+        for (auto i = first; i != last; ++i) {
+            if (!has_f(i->first) && !has_s(i->second) &&
+                (single || ((fs.find(i->first) == fs.end()) && (ss.find(i->second) == ss.end())))) {
+                if (not single) {
+                    fs.insert(i->first);
+                    ss.insert(i->second);
+                }
+                items.push_back(*i);
+            }
+        }
+        insert_items(std::move(items));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
     /**
      * @brief      process to insert items.
      * @tparam     InputIt: iterator type.
@@ -531,39 +1367,135 @@ private:
      *                   biunique or not.
      * @param[in]  dummy: compile switcher. in this case, POLICY == Throwing.
      * @throw      std::invalid_argument: if fails to insert an item.
+     * @note       this process is transactional. nothing is inserted if an
+     *             exception is thrown. the cost is O(k log(n + k)) for
+     *             ordered types and O(k) for unordered_no_default, where n
+     *             is size() and k is the number of items.
      */
     template <typename InputIt>
     void insert_impl(InputIt first, InputIt last, bool self, sPolicy<biunique_map_policy::throwing> dummy)
     {
-        if (not self) {
-            for (auto i = first; i != last; ++i) {
-                for (auto j = std::next(i, 1); j != last; ++j) {
-                    if ((i->first == j->first) || (i->second == j->second)) {
-                        throw std::invalid_argument("");
-                    }
+        // items are checked against registered data, and against each other
+        // by temporary sets unless they come from another biunique_map or
+        // there is only one item. empty sets allocate no node.
+        fset_type fs(get_allocator());
+        sset_type ss(get_allocator());
+        const bool single = (first == last) || (std::next(first) == last);
+        for (auto i = first; i != last; ++i) {
+            if (has_f(i->first) || has_s(i->second)) {
+                throw std::invalid_argument("");
+            }
+            if (not self && not single) {
+                if (!fs.insert(i->first).second || !ss.insert(i->second).second) {
+                    throw std::invalid_argument("");
                 }
             }
         }
 
-        for (const auto& i: m_) {
-            for (auto j = first; j != last; ++j) {
-                if ((i.first == j->first) || (i.second == j->second)) {
-                    throw std::invalid_argument("");
-                }
+        insert_checked(first, last, is_flat{});
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      process to insert checked items. nothing is inserted if
+     *             an exception is thrown.
+     * @tparam     InputIt: iterator type.
+     * @param[in]  first: first iterator
+     * @param[in]  last: last iterator
+     * @param[in]  dummy: compile switcher. in this case, TYPE is not flat_no_default.
+     */
+    template <typename InputIt>
+    void insert_checked(InputIt first, InputIt last, std::false_type dummy)
+    {
+        auto i = first;
+        try {
+            for (; i != last; ++i) {
+                insert_item(*i);
+            }
+        }
+        catch (...) {
+            for (auto j = first; j != i; ++j) {
+                erase_by_f(j->first);
             }
+            throw;
         }
+    }
+    /////////////////////////////////////////////////////////////////////////////
 
-        for (auto i = first; i != last; ++i) {
-            m_.insert(*i);
+    /**
+     * @brief      process to insert checked items. nothing is inserted if
+     *             an exception is thrown.
+     * @tparam     InputIt: iterator type.
+     * @param[in]  first: first iterator
+     * @param[in]  last: last iterator
+     * @param[in]  dummy: compile switcher. in this case, TYPE == flat_no_default.
+     */
+    template <typename InputIt>
+    void insert_checked(InputIt first, InputIt last, std::true_type dummy)
+    {
+        insert_items(items_type(first, last, get_allocator()));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      insert items into sorted vectors at once.
+     *             nothing is inserted if an exception is thrown.
+     * @param[in]  items: items which are not registered yet.
+     */
+    void insert_items(items_type&& items)
+    {
+        if (items.empty()) {
+            return;
+        }
+
+        ritems_type ritems(get_allocator());
+        ritems.reserve(items.size());
+        for (const auto& i: items) {
+            ritems.emplace_back(i.second, i.first);
+        }
+        map_type m = m_.merged(std::move(items));
+        rmap_type r = r_.merged(std::move(ritems));
+        m_.swap(m);
+        r_.swap(r);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      insert an item into both of map and reverse index.
+     * @param[in]  v: item which is not registered yet.
+     */
+    void insert_item(const value_type& v)
+    {
+        auto i = m_.insert(v).first;
+        try {
+            r_.emplace(v.second, v.first);
+        }
+        catch (...) {
+            m_.erase(i);
+            throw;
         }
     }
     /////////////////////////////////////////////////////////////////////////////
 
 private:
     map_type m_; // stores biunique map data
+    rmap_type r_; // reverse index of m_
 };
 /////////////////////////////////////////////////////////////////////////////
 
+#if __cplusplus >= 201703L
+namespace pmr {
+
+/**
+ * @brief      biunique_map with std::pmr::polymorphic_allocator.
+ */
+template <typename F, typename S, biunique_map_type TYPE=biunique_map_type::ordered_no_default, biunique_map_policy POLICY=biunique_map_policy::silence>
+using biunique_map = ken3::biunique_map<F, S, TYPE, POLICY, std::pmr::polymorphic_allocator<std::pair<const F, S>>>;
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace pmr {
+#endif
+
 } // namespace ken3 {
 
 #endif // #ifndef INCLUDE_GUARD_KEN3_BIUNIQUE_MAP_HPP
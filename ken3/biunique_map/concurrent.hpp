@@ -0,0 +1,514 @@
+/**
+ * @file    ken3/biunique_map/concurrent.hpp
+ * @brief   Implementation of concurrent_biunique_map class.
+ *          concurrent_biunique_map is a biunique_map for many reader threads
+ *          and a few writer threads.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more.
+ * @remark  this module works only with header files.
+ *
+ * @note
+ * Typical usage is;
+ *     ken3::concurrent_biunique_map<int, std::string> bm{{1, "one"}};
+ *     // reader threads
+ *     std::string s = bm.f2s(1); // => "one"
+ *     // writer thread
+ *     bm.insert(2, "two");
+ *
+ * f2s(), s2f(), has_f(), has_s(), size(), empty(), and snapshot() are
+ * wait-free. they never wait for writers nor other readers. this class
+ * uses Left-Right algorithm. it has two instances of biunique_map, and
+ * readers read one of them while a writer modifies the other. after the
+ * writer switches readers to the modified instance, the writer waits for
+ * readers of the old instance, and applies the same modification to it.
+ * thus, writers are serialized, and each modification is done twice.
+ *
+ * f2s() and s2f() return values, not references, because the referred
+ * data may be modified after the reader leaves.
+ * insert() follows POLICY as same as biunique_map.
+ */
+
+#ifndef INCLUDE_GUARD_KEN3_BIUNIQUE_MAP_CONCURRENT_HPP
+#define INCLUDE_GUARD_KEN3_BIUNIQUE_MAP_CONCURRENT_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "ken3/biunique_map.hpp"
+
+namespace ken3 {
+
+namespace biunique_map_detail {
+
+/**
+ * @class   read_indicator
+ * @brief   counter of readers. it is striped to avoid contention among
+ *          reader threads.
+ */
+class read_indicator
+{
+public:
+    /**
+     * @brief      default constructor. no readers.
+     */
+    read_indicator(void)
+    {
+        for (auto& i: stripes_) {
+            i.count.store(0);
+        }
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      read_indicator is neither copyable nor movable.
+     */
+    read_indicator(const read_indicator& src) = delete;
+    read_indicator& operator=(const read_indicator& rhs) = delete;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      a reader arrives.
+     */
+    void arrive(void) noexcept
+    {
+        stripes_[stripe()].count.fetch_add(1);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      a reader departs.
+     */
+    void depart(void) noexcept
+    {
+        stripes_[stripe()].count.fetch_sub(1);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      check whether no reader is present.
+     * @return     true: no reader, false: some readers
+     */
+    bool empty(void) const noexcept
+    {
+        for (const auto& i: stripes_) {
+            if (i.count.load() != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    /**
+     * @brief      get stripe index of the current thread.
+     * @return     stripe index
+     */
+    static std::size_t stripe(void) noexcept
+    {
+        static std::atomic<std::size_t> next(0);
+        thread_local std::size_t index = next.fetch_add(1) % stripe_size;
+        return index;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    static constexpr std::size_t stripe_size = 16;
+
+    // each counter is placed in its own cache line
+    struct alignas(64) stripe_type
+    {
+        std::atomic<long> count;
+    };
+    stripe_type stripes_[stripe_size];
+};
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace biunique_map_detail {
+
+/**
+ * @class   concurrent_biunique_map
+ * @brief   A biunique_map, which can be read by many threads without locks.
+ * @tparam  F: key type of biunique_map.
+ * @tparam  S: mapped type of biunique_map.
+ * @tparam  TYPE: biunique_map_type. default is ordered_no_default.
+ * @tparam  POLICY: biunique_map_policy. default silence.
+ */
+template <typename F, typename S, biunique_map_type TYPE=biunique_map_type::ordered_no_default, biunique_map_policy POLICY=biunique_map_policy::silence>
+class concurrent_biunique_map
+{
+public:
+    // type definitions
+    using map_type   = biunique_map<F, S, TYPE, POLICY>;
+    using value_type = typename map_type::value_type;
+    using size_type  = typename map_type::size_type;
+private:
+    using self_type  = concurrent_biunique_map<F, S, TYPE, POLICY>;
+    /////////////////////////////////////////////////////////////////////////////
+
+public:
+    /**
+     * @brief      default constructor. map is empty.
+     */
+    concurrent_biunique_map(void) = default;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with initializer_list.
+     * @param[in]  init: source of constructor
+     * @note       if init includes duplex value,
+     *             - duplex value is ignored if POLICY is Silence.
+     *             - invalid_argument is thrown if POLICY is Throwing.
+     */
+    concurrent_biunique_map(std::initializer_list<value_type> init) :
+        instances_{map_type(init), map_type(init)}
+    {
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with biunique_map.
+     * @param[in]  m: source of constructor
+     */
+    explicit concurrent_biunique_map(const map_type& m) :
+        instances_{m, m}
+    {
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      concurrent_biunique_map is neither copyable nor movable.
+     *             use snapshot() to get a copy.
+     */
+    concurrent_biunique_map(const self_type& src) = delete;
+    concurrent_biunique_map(self_type&& src) = delete;
+    self_type& operator=(const self_type& rhs) = delete;
+    self_type& operator=(self_type&& rhs) = delete;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert from key value to mapped value. wait-free.
+     * @param[in]  f: key value.
+     * @return     copy of mapped value, which is connected to f.
+     * @note       same as biunique_map::f2s() about not found f.
+     */
+    S f2s(const F& f) const
+    {
+        return read([&f](const map_type& m) -> S { return m.f2s(f); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert from mapped value to key value. wait-free.
+     * @param[in]  s: mapped value.
+     * @return     copy of key value, which is connected to s.
+     * @note       same as biunique_map::s2f() about not found s.
+     */
+    F s2f(const S& s) const
+    {
+        return read([&s](const map_type& m) -> F { return m.s2f(s); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert key values to mapped values in a batch. wait-free.
+     *             all values are converted by one instance, and writers
+     *             wait for the batch.
+     * @param[in]  first: first iterator of key values.
+     * @param[in]  last: last iterator of key values.
+     * @param[out] out: output iterator of mapped values.
+     * @return     output iterator after the last converted value.
+     * @note       same as biunique_map::f2s_many().
+     */
+    template <typename InputIt, typename OutputIt>
+    OutputIt f2s_many(InputIt first, InputIt last, OutputIt out) const
+    {
+        return read([&](const map_type& m) -> OutputIt { return m.f2s_many(first, last, out); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert key values to mapped values in a batch. wait-free.
+     * @param[in]  first: first iterator of key values.
+     * @param[in]  last: last iterator of key values.
+     * @param[out] out: output iterator of mapped values.
+     * @param[in]  defaultS: written value if key value is not found.
+     * @return     output iterator after the last converted value.
+     * @note       same as biunique_map::f2s_many().
+     */
+    template <typename InputIt, typename OutputIt>
+    OutputIt f2s_many(InputIt first, InputIt last, OutputIt out, const S& defaultS) const
+    {
+        return read([&](const map_type& m) -> OutputIt { return m.f2s_many(first, last, out, defaultS); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert mapped values to key values in a batch. wait-free.
+     * @param[in]  first: first iterator of mapped values.
+     * @param[in]  last: last iterator of mapped values.
+     * @param[out] out: output iterator of key values.
+     * @return     output iterator after the last converted value.
+     * @note       same as biunique_map::s2f_many().
+     */
+    template <typename InputIt, typename OutputIt>
+    OutputIt s2f_many(InputIt first, InputIt last, OutputIt out) const
+    {
+        return read([&](const map_type& m) -> OutputIt { return m.s2f_many(first, last, out); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert mapped values to key values in a batch. wait-free.
+     * @param[in]  first: first iterator of mapped values.
+     * @param[in]  last: last iterator of mapped values.
+     * @param[out] out: output iterator of key values.
+     * @param[in]  defaultF: written value if mapped value is not found.
+     * @return     output iterator after the last converted value.
+     * @note       same as biunique_map::s2f_many().
+     */
+    template <typename InputIt, typename OutputIt>
+    OutputIt s2f_many(InputIt first, InputIt last, OutputIt out, const F& defaultF) const
+    {
+        return read([&](const map_type& m) -> OutputIt { return m.s2f_many(first, last, out, defaultF); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      check if f is already registered as key value. wait-free.
+     * @param[in]  f: key value to be checked.
+     * @return     true: f is already registered, false: not registered
+     */
+    bool has_f(const F& f) const
+    {
+        return read([&f](const map_type& m) -> bool { return m.has_f(f); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      check if s is already registered as mapped value. wait-free.
+     * @param[in]  s: mapped value to be checked.
+     * @return     true: s is already registered, false: not registered
+     */
+    bool has_s(const S& s) const
+    {
+        return read([&s](const map_type& m) -> bool { return m.has_s(s); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get size. wait-free.
+     * @return     size of map.
+     */
+    size_type size(void) const
+    {
+        return read([](const map_type& m) -> size_type { return m.size(); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get empty or not. wait-free.
+     * @return     true: empty, false: not empty
+     */
+    bool empty(void) const
+    {
+        return read([](const map_type& m) -> bool { return m.empty(); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get copy of current data. wait-free, but it costs O(n).
+     * @return     copy of current data.
+     */
+    map_type snapshot(void) const
+    {
+        return read([](const map_type& m) -> map_type { return m; });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      insert a pair. new data is published to readers at once.
+     * @param[in]  f: key value to be inserted.
+     * @param[in]  s: mapped value to be inserted.
+     * @note       if f or s is duplex value,
+     *             - do nothing if POLICY is Silence.
+     *             - invalid_argument is thrown if POLICY is Throwing.
+     */
+    void insert(const F& f, const S& s)
+    {
+        write([&f, &s](map_type& m) { m.insert(f, s); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      insert from initializer_list.
+     * @param[in]  init: source of inserting
+     * @note       same as biunique_map::insert() about duplex values.
+     */
+    void insert(std::initializer_list<value_type> init)
+    {
+        write([&init](map_type& m) { m.insert(init); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      insert iterator.
+     * @param[in]  first: first iterator
+     * @param[in]  last: last iterator
+     * @note       same as biunique_map::insert() about duplex values.
+     */
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        // the same items are inserted into both instances
+        std::vector<value_type> items(first, last);
+        write([&items](map_type& m) { m.insert(items.cbegin(), items.cend()); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      erase one pair by key value.
+     * @param[in]  f: key value to be removed.
+     */
+    void erase_by_f(const F& f)
+    {
+        write([&f](map_type& m) { m.erase_by_f(f); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      erase one pair by mapped value.
+     * @param[in]  s: mapped value to be removed.
+     */
+    void erase_by_s(const S& s)
+    {
+        write([&s](map_type& m) { m.erase_by_s(s); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      clear all data
+     */
+    void clear(void)
+    {
+        write([](map_type& m) { m.clear(); });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      replace all data.
+     * @param[in]  m: new data
+     */
+    void assign(const map_type& m)
+    {
+        write([&m](map_type& dst) { dst = m; });
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    /**
+     * @brief      process to read current instance.
+     * @tparam     FUNC: function type.
+     * @param[in]  func: reading function. it takes const map_type&.
+     * @return     return value of func.
+     */
+    template <typename FUNC>
+    auto read(FUNC func) const -> decltype(func(std::declval<const map_type&>()))
+    {
+        // the indicator is departed even if func throws
+        struct guard
+        {
+            explicit guard(biunique_map_detail::read_indicator& ri) : ri_(ri)
+            {
+                ri_.arrive();
+            }
+            ~guard(void)
+            {
+                ri_.depart();
+            }
+            biunique_map_detail::read_indicator& ri_;
+        };
+        guard g(indicators_[version_.load()]);
+        return func(instances_[current_.load()]);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      process to modify both instances.
+     * @tparam     FUNC: function type.
+     * @param[in]  func: modifying function. it takes map_type&.
+     *                   it shall be transactional.
+     * @throw      exception thrown by the first call of func.
+     *             nothing is changed in this case.
+     * @note       the modification is published once the first call succeeds.
+     *             if the second call throws, the stale instance is replaced by
+     *             a copy of the published one, and std::terminate() is called
+     *             if the copy also throws.
+     */
+    template <typename FUNC>
+    void write(FUNC func)
+    {
+        std::lock_guard<std::mutex> lock(writer_);
+
+        // modify the instance which is not read, then publish it
+        int current = current_.load();
+        func(instances_[1 - current]);
+        current_.store(1 - current);
+
+        // wait for readers which may read the old instance
+        int version = version_.load();
+        wait_for(indicators_[1 - version]);
+        version_.store(1 - version);
+        wait_for(indicators_[version]);
+
+        // the old instance is no longer read
+        try {
+            func(instances_[current]);
+        }
+        catch (...) {
+            resync(current);
+        }
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      make the stale instance same as the published one.
+     * @param[in]  stale: index of the stale instance.
+     * @note       std::terminate() is called if the copy throws,
+     *             because the two instances can not be kept same.
+     */
+    void resync(int stale) noexcept
+    {
+        instances_[stale] = instances_[1 - stale];
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      wait until no reader is present.
+     * @param[in]  ri: read indicator.
+     */
+    static void wait_for(const biunique_map_detail::read_indicator& ri)
+    {
+        while (!ri.empty()) {
+            std::this_thread::yield();
+        }
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    map_type instances_[2];                                 // readers read instances_[current_]
+    std::atomic<int> current_{0};                           // index of instance for readers
+    std::atomic<int> version_{0};                           // index of indicator for readers
+    mutable biunique_map_detail::read_indicator indicators_[2];
+    std::mutex writer_;                                     // serializes writers
+};
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace ken3 {
+
+#endif // #ifndef INCLUDE_GUARD_KEN3_BIUNIQUE_MAP_CONCURRENT_HPP
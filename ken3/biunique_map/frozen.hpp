@@ -0,0 +1,441 @@
+/**
+ * @file    ken3/biunique_map/frozen.hpp
+ * @brief   Implementation of frozen_biunique_map class.
+ *          frozen_biunique_map is a read-only biunique_map, which finds
+ *          data by minimal perfect hash functions.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more.
+ * @remark  this module works only with header files.
+ *
+ * @note
+ * Typical usage is;
+ *     static const ken3::frozen_biunique_map<int, std::string> colors{
+ *         {0, "red"}, {1, "green"}, {2, "blue"},
+ *     };
+ *     std::cout << colors.f2s(1); // => "green"
+ *     std::cout << colors.s2f("blue"); // => 2
+ *
+ * Minimal perfect hash functions for both directions are built when the
+ * map is constructed, by hash-and-displace method. each lookup computes
+ * two hash values, reads one seed and one slot, and compares one key.
+ * no probing is needed. pairs are stored in one flat array in order of
+ * key value slots, and the slots of mapped value refer to it by index.
+ * F and S need std::hash (or appointed hash functors) and operator==.
+ */
+
+#ifndef INCLUDE_GUARD_KEN3_BIUNIQUE_MAP_FROZEN_HPP
+#define INCLUDE_GUARD_KEN3_BIUNIQUE_MAP_FROZEN_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "ken3/biunique_map.hpp"
+
+namespace ken3 {
+
+namespace biunique_map_detail {
+
+/**
+ * @brief      mix bits of hash value. it is splitmix64 finalizer.
+ * @param[in]  x: source value
+ * @return     mixed value
+ */
+inline std::uint64_t mix(std::uint64_t x) noexcept
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      reduce hash value into [0, n) by multiplication instead of modulo.
+ * @param[in]  x: mixed hash value
+ * @param[in]  n: range, which shall be less than 2^32.
+ * @return     value in [0, n)
+ */
+inline std::size_t reduce(std::uint64_t x, std::size_t n) noexcept
+{
+    return static_cast<std::size_t>(((x >> 32) * static_cast<std::uint64_t>(n)) >> 32);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class   perfect_hash
+ * @brief   minimal perfect hash function for n hash values, which is built
+ *          by hash-and-displace method.
+ */
+class perfect_hash
+{
+public:
+    /**
+     * @brief      default constructor. no values.
+     */
+    perfect_hash(void) = default;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor. build minimal perfect hash function.
+     * @param[in]  hashes: hash values of keys, which shall be distinct keys.
+     * @throw      std::invalid_argument: if hash values are duplex.
+     * @throw      std::length_error: if the number of values is 2^32 or more.
+     */
+    explicit perfect_hash(const std::vector<std::uint64_t>& hashes) :
+        salt_(0),
+        seeds_(),
+        size_(hashes.size())
+    {
+        if (static_cast<std::uint64_t>(size_) > 0xffffffffULL) {
+            throw std::length_error("too many values");
+        }
+        std::vector<std::uint64_t> sorted(hashes);
+        std::sort(sorted.begin(), sorted.end());
+        if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+            throw std::invalid_argument("duplex hash value");
+        }
+
+        // retry with another salt in the rare case of failure
+        while (!build(hashes)) {
+            salt_++;
+        }
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get slot of hash value.
+     * @param[in]  hash: hash value
+     * @return     slot in [0, size). if hash is not one of built values,
+     *             the slot is valid, but the value in the slot differs.
+     */
+    std::size_t slot(std::uint64_t hash) const noexcept
+    {
+        std::uint64_t h = mix(hash ^ salt_);
+        std::uint32_t seed = seeds_[reduce(h, seeds_.size())];
+        return reduce(mix(h + seed), size_);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    /**
+     * @brief      process to build. buckets of more values are placed first.
+     * @param[in]  hashes: hash values of keys.
+     * @return     true: success, false: failure
+     */
+    bool build(const std::vector<std::uint64_t>& hashes)
+    {
+        const std::uint32_t max_seed = 1U << 20;
+        std::size_t n = hashes.size();
+        std::size_t bucket_size = std::max<std::size_t>(1, (n + 3) / 4);
+
+        std::vector<std::vector<std::uint64_t>> buckets(bucket_size);
+        for (const auto& i: hashes) {
+            std::uint64_t h = mix(i ^ salt_);
+            buckets[reduce(h, bucket_size)].push_back(h);
+        }
+        std::vector<std::size_t> order(bucket_size);
+        for (std::size_t i = 0; i < bucket_size; i++) {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&buckets](std::size_t lhs, std::size_t rhs) {
+            return buckets[lhs].size() > buckets[rhs].size();
+        });
+
+        seeds_.assign(bucket_size, 0);
+        std::vector<bool> used(n, false);
+        std::vector<std::size_t> slots;
+        for (const auto& b: order) {
+            if (buckets[b].empty()) {
+                break;
+            }
+            std::uint32_t seed = 0;
+            for (; seed < max_seed; seed++) {
+                slots.clear();
+                for (const auto& h: buckets[b]) {
+                    std::size_t s = reduce(mix(h + seed), n);
+                    if (used[s] || (std::find(slots.begin(), slots.end(), s) != slots.end())) {
+                        break;
+                    }
+                    slots.push_back(s);
+                }
+                if (slots.size() == buckets[b].size()) {
+                    break;
+                }
+            }
+            if (seed == max_seed) {
+                return false;
+            }
+            seeds_[b] = seed;
+            for (const auto& s: slots) {
+                used[s] = true;
+            }
+        }
+        return true;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    std::uint64_t salt_ = 0;
+    std::vector<std::uint32_t> seeds_;
+    std::size_t size_ = 0;
+};
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace biunique_map_detail {
+
+/**
+ * @class   frozen_biunique_map
+ * @brief   A read-only biunique_map with minimal perfect hash functions.
+ * @tparam  F: key type of biunique_map.
+ * @tparam  S: mapped type of biunique_map.
+ * @tparam  POLICY: biunique_map_policy for construction. default silence.
+ * @tparam  HashF: hash functor of F.
+ * @tparam  HashS: hash functor of S.
+ */
+template <typename F, typename S, biunique_map_policy POLICY=biunique_map_policy::silence,
+          typename HashF=std::hash<F>, typename HashS=std::hash<S>>
+class frozen_biunique_map
+{
+public:
+    // type definitions
+    using value_type     = std::pair<F, S>;
+    using size_type      = std::size_t;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      default-constructor, copy-constructor, move-constructor, destructor,
+     *             copy-operator=, and move-operator= are default.
+     */
+    frozen_biunique_map(void) = default;
+    frozen_biunique_map(const frozen_biunique_map& src) = default;
+    frozen_biunique_map(frozen_biunique_map&& src) = default;
+    frozen_biunique_map& operator=(const frozen_biunique_map& rhs) = default;
+    frozen_biunique_map& operator=(frozen_biunique_map&& rhs) = default;
+    ~frozen_biunique_map(void) = default;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      iterator constructor.
+     * @param[in]  first: first iterator
+     * @param[in]  last: last iterator
+     * @note       if items include duplex value,
+     *             - duplex value is ignored if POLICY is Silence.
+     *             - invalid_argument is thrown if POLICY is Throwing.
+     *             invalid_argument is also thrown if hash values of
+     *             different values are same.
+     */
+    template <typename InputIt>
+    frozen_biunique_map(InputIt first, InputIt last)
+    {
+        build(first, last);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with initializer_list.
+     * @param[in]  init: source of constructor
+     * @note       same as iterator constructor about duplex values.
+     */
+    frozen_biunique_map(std::initializer_list<value_type> init)
+    {
+        build(init.begin(), init.end());
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get size.
+     * @return     size of map.
+     */
+    size_type size(void) const noexcept
+    {
+        return items_.size();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get empty or not.
+     * @return     true: empty, false: not empty
+     */
+    bool empty(void) const noexcept
+    {
+        return items_.empty();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get begin iterator. the order of items is not specified.
+     * @return     begin
+     */
+    const_iterator cbegin(void) const noexcept
+    {
+        return items_.cbegin();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get end iterator.
+     * @return     end
+     */
+    const_iterator cend(void) const noexcept
+    {
+        return items_.cend();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      check if f is registered as key value.
+     * @param[in]  f: key value to be checked.
+     * @return     true: f is registered, false: not registered
+     */
+    bool has_f(const F& f) const
+    {
+        return find_f(f) != nullptr;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      check if s is registered as mapped value.
+     * @param[in]  s: mapped value to be checked.
+     * @return     true: s is registered, false: not registered
+     */
+    bool has_s(const S& s) const
+    {
+        return find_s(s) != nullptr;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert from key value to mapped value.
+     * @param[in]  f: key value.
+     * @return     mapped value, which is connected to f.
+     * @throw      std::out_of_range: if f is not found.
+     */
+    const S& f2s(const F& f) const
+    {
+        const value_type* p = find_f(f);
+        if (p == nullptr) {
+            throw std::out_of_range("");
+        }
+        return p->second;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      convert from mapped value to key value.
+     * @param[in]  s: mapped value.
+     * @return     key value, which is connected to s.
+     * @throw      std::out_of_range: if s is not found.
+     */
+    const F& s2f(const S& s) const
+    {
+        const value_type* p = find_s(s);
+        if (p == nullptr) {
+            throw std::out_of_range("");
+        }
+        return p->first;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    /**
+     * @brief      process to build hash functions and arrays.
+     * @param[in]  first: first iterator
+     * @param[in]  last: last iterator
+     */
+    template <typename InputIt>
+    void build(InputIt first, InputIt last)
+    {
+        // duplex values are handled as same as biunique_map with POLICY, by
+        // sets which use HashF and HashS
+        std::unordered_set<F, HashF> fs;
+        std::unordered_set<S, HashS> ss;
+        std::vector<value_type> items;
+        for (auto i = first; i != last; ++i) {
+            if ((fs.find(i->first) == fs.end()) && (ss.find(i->second) == ss.end())) {
+                fs.insert(i->first);
+                ss.insert(i->second);
+                items.emplace_back(i->first, i->second);
+            }
+            else if (POLICY == biunique_map_policy::throwing) {
+                throw std::invalid_argument("");
+            }
+        }
+        if (items.empty()) {
+            return;
+        }
+
+        std::vector<std::uint64_t> fh;
+        std::vector<std::uint64_t> sh;
+        for (const auto& i: items) {
+            fh.push_back(HashF()(i.first));
+            sh.push_back(HashS()(i.second));
+        }
+        f_hash_ = biunique_map_detail::perfect_hash(fh);
+        s_hash_ = biunique_map_detail::perfect_hash(sh);
+
+        // items are placed in slots of key value
+        std::vector<std::size_t> index(items.size());
+        for (std::size_t j = 0; j < items.size(); j++) {
+            index[f_hash_.slot(fh[j])] = j;
+        }
+        items_.reserve(items.size());
+        for (const auto& i: index) {
+            items_.push_back(std::move(items[i]));
+        }
+
+        s_slots_.assign(items_.size(), 0);
+        for (std::size_t i = 0; i < items_.size(); i++) {
+            s_slots_[s_hash_.slot(HashS()(items_[i].second))] = static_cast<std::uint32_t>(i);
+        }
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      find item by key value.
+     * @param[in]  f: key value.
+     * @return     pointer to item. nullptr if not found.
+     */
+    const value_type* find_f(const F& f) const
+    {
+        if (items_.empty()) {
+            return nullptr;
+        }
+        const value_type& i = items_[f_hash_.slot(HashF()(f))];
+        return (i.first == f) ? &i : nullptr;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      find item by mapped value.
+     * @param[in]  s: mapped value.
+     * @return     pointer to item. nullptr if not found.
+     */
+    const value_type* find_s(const S& s) const
+    {
+        if (items_.empty()) {
+            return nullptr;
+        }
+        const value_type& i = items_[s_slots_[s_hash_.slot(HashS()(s))]];
+        return (i.second == s) ? &i : nullptr;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    std::vector<value_type> items_;          // items in order of slots of key value
+    std::vector<std::uint32_t> s_slots_;     // index of items_ in order of slots of mapped value
+    biunique_map_detail::perfect_hash f_hash_;
+    biunique_map_detail::perfect_hash s_hash_;
+};
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace ken3 {
+
+#endif // #ifndef INCLUDE_GUARD_KEN3_BIUNIQUE_MAP_FROZEN_HPP
@@ -6,6 +6,7 @@
  * @date    2019-12-13
  * @version 0.1.0
  * @remark  the target is C++11 or more.
+ * @remark  this module works only with header files.
  *
  * @note
  * Typical usage is;
@@ -14,29 +15,878 @@
  *     std::cout << double(f12); // => "0.5"
  *     fraction f13(1, 3);
  *     std::cout << (f12 + f13); // => "5/6"
+ *
+ * constructors, comparisons, arithmetic operators (+, -, *, /) and casts
+ * are constexpr. thus, constant fractions are folded at compile time;
+ *     constexpr fraction f56 = fraction(1, 2) + fraction(1, 3);
+ *     static_assert(f56 == fraction(5, 6), "folded at compile time");
+ * the overflow which throws at run time makes a compile error in constant
+ * expressions. compound operators (+=, -=, *=, /=) are not constexpr
+ * because of C++11, but inlined as same as the others.
+ *
+ * fraction is basic_fraction<std::intmax_t>. basic_fraction accepts other
+ * signed integers, __int128, and ken3::wide_int<N> in ken3/fraction/wide_int.hpp;
+ *     basic_fraction<__int128> f(1, 3);
+ *     basic_fraction<ken3::wide_int<256>> w(1, 3);
+ * +, -, * and operator< calculate intermediates in the wider type
+ * (64 bits: __int128, __int128: none, wide_int<N>: wide_int<2N>), thus
+ * std::overflow_error is thrown only when the reduced result does not fit.
+ * without the wider type, each intermediate is checked.
+ *
+ * try_make() and try_add(), try_sub(), try_mul(), try_div() report errors
+ * by ken3::fraction_errc instead of exceptions, and do not change the
+ * fraction on error;
+ *     fraction f(1, 2);
+ *     if (f.try_add(g) == ken3::fraction_errc::overflow) { ... }
+ * if exceptions are disabled (ex. -fno-exceptions), the errors which are
+ * thrown by the other functions call std::abort().
  */
 
 #ifndef INCLUDE_GUARD_KEN3_FRACTION_HPP
 #define INCLUDE_GUARD_KEN3_FRACTION_HPP
 
+#include <climits>
+#include <cmath>
 #include <cstdint>
-#include <stdexcept>
+#include <cstdlib>
 #include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
+#include "ken3/overflow.hpp"
 
 namespace ken3 {
 
 /**
- * @class   fraction
+ * @enum    fraction_errc
+ * @brief   error codes of try_make() and try_*() of basic_fraction.
+ *          each code except ok corresponds to the exception of the operators.
+ */
+enum class fraction_errc
+{
+    ok = 0,           ///< no error
+    overflow,         ///< std::overflow_error
+    zero_denominator, ///< std::runtime_error
+    invalid_argument, ///< std::invalid_argument
+    domain_error,     ///< std::domain_error
+};
+/////////////////////////////////////////////////////////////////////////////
+
+namespace fraction_detail {
+
+/**
+ * @brief      throw the exception which corresponds to the error code.
+ *             if exceptions are disabled (ex. -fno-exceptions), std::abort()
+ *             is called instead. thus, programs built without exceptions
+ *             should use try_make() and try_*().
+ * @param[in]  e: error code (!= fraction_errc::ok)
+ * @param[in]  what: message of the exception. nullptr means the default one.
+ * @tparam     T: dummy return type, which makes this usable in conditional
+ *             expressions of constexpr functions.
+ * @return     never returns
+ */
+template <typename T = void>
+[[noreturn]] T raise_error(fraction_errc e, const char* what = nullptr)
+{
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    switch (e) {
+    case fraction_errc::zero_denominator:
+        throw std::runtime_error((what != nullptr) ? what : "0 is not allowed in the denominator");
+    case fraction_errc::invalid_argument:
+        throw std::invalid_argument((what != nullptr) ? what : "invalid argument");
+    case fraction_errc::domain_error:
+        throw std::domain_error((what != nullptr) ? what : "infinity or NaN is not allowed");
+    default:
+        throw std::overflow_error((what != nullptr) ? what : "");
+    }
+#else
+    static_cast<void>(e);
+    static_cast<void>(what);
+    std::abort();
+#endif
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      throw the exception if e is an error.
+ * @param[in]  e: error code
+ * @throw      the exception which corresponds to e. see raise_error().
+ */
+inline void check_error(fraction_errc e)
+{
+    if (e != fraction_errc::ok) {
+        raise_error(e);
+    }
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct  int_traits
+ * @brief   properties of integer type for basic_fraction.
+ *          min() and max() are limits, count_trailing_zeros(x) counts
+ *          trailing zero bits of x (> 0), and wider_type is used for
+ *          intermediates. wider_type is void if there is no wider type.
+ */
+template <typename T, typename V = void>
+struct int_traits;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct  int_traits
+ * @brief   int_traits for built-in signed integers.
+ */
+template <typename T>
+struct int_traits<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type>
+{
+#if defined(__SIZEOF_INT128__)
+    using wider_type = typename std::conditional<(sizeof(T) < sizeof(long long)), long long,
+                       typename std::conditional<(sizeof(T) == sizeof(long long)), __int128, void>::type>::type;
+#else
+    using wider_type = typename std::conditional<(sizeof(T) < sizeof(long long)), long long, void>::type;
+#endif
+
+    static constexpr T min(void) noexcept
+    {
+        return std::numeric_limits<T>::min();
+    }
+
+    static constexpr T max(void) noexcept
+    {
+        return std::numeric_limits<T>::max();
+    }
+
+    static constexpr int count_trailing_zeros(T x) noexcept
+    {
+#if defined(__GNUC__)
+        return __builtin_ctzll(static_cast<unsigned long long>(x));
+#else
+        return ((x & 1) != 0) ? 0 : (1 + count_trailing_zeros(x >> 1));
+#endif
+    }
+};
+/////////////////////////////////////////////////////////////////////////////
+
+#if defined(__SIZEOF_INT128__)
+/**
+ * @struct  int_traits
+ * @brief   int_traits for __int128, which is the widest built-in integer.
+ */
+template <>
+struct int_traits<__int128, void>
+{
+    using wider_type = void;
+
+    static constexpr __int128 max(void) noexcept
+    {
+        return static_cast<__int128>((static_cast<unsigned __int128>(1) << 127) - 1);
+    }
+
+    static constexpr __int128 min(void) noexcept
+    {
+        return -max() - 1;
+    }
+
+    static constexpr int count_trailing_zeros(__int128 x) noexcept
+    {
+        return (static_cast<unsigned long long>(x) != 0) ? __builtin_ctzll(static_cast<unsigned long long>(x)) :
+               (64 + __builtin_ctzll(static_cast<unsigned long long>(x >> 64)));
+    }
+};
+/////////////////////////////////////////////////////////////////////////////
+#endif
+
+/**
+ * @brief      check overflow condition of (x + y) by ken3::overflow.
+ * @param[in]  x: lhs of (x + y)
+ * @param[in]  y: rhs of (x + y)
+ * @param[in]  dummy: compile switcher. in this case, T is a builtin integer.
+ * @return     true: overflow occurs by (x + y). false: no overflow
+ */
+template <typename T>
+constexpr bool occur_add(const T& x, const T& y, std::true_type dummy) noexcept
+{
+    return overflow::occur_add(x, y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      check overflow condition of (x + y) by comparisons.
+ * @param[in]  x: lhs of (x + y)
+ * @param[in]  y: rhs of (x + y)
+ * @param[in]  dummy: compile switcher. in this case, T is not a builtin integer.
+ * @return     true: overflow occurs by (x + y). false: no overflow
+ */
+template <typename T>
+constexpr bool occur_add(const T& x, const T& y, std::false_type dummy) noexcept
+{
+    return (
+        ((y > 0) && (x > (int_traits<T>::max() - y))) ||
+        ((y < 0) && (x < (int_traits<T>::min() - y)))
+    );
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      check overflow condition of (x - y) by ken3::overflow.
+ * @param[in]  x: lhs of (x - y)
+ * @param[in]  y: rhs of (x - y)
+ * @param[in]  dummy: compile switcher. in this case, T is a builtin integer.
+ * @return     true: overflow occurs by (x - y). false: no overflow
+ */
+template <typename T>
+constexpr bool occur_sub(const T& x, const T& y, std::true_type dummy) noexcept
+{
+    return overflow::occur_sub(x, y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      check overflow condition of (x - y) by comparisons.
+ * @param[in]  x: lhs of (x - y)
+ * @param[in]  y: rhs of (x - y)
+ * @param[in]  dummy: compile switcher. in this case, T is not a builtin integer.
+ * @return     true: overflow occurs by (x - y). false: no overflow
+ */
+template <typename T>
+constexpr bool occur_sub(const T& x, const T& y, std::false_type dummy) noexcept
+{
+    return (
+        ((y > 0) && (x < (int_traits<T>::min() + y))) ||
+        ((y < 0) && (x > (int_traits<T>::max() + y)))
+    );
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      check overflow condition of (x * y) by ken3::overflow.
+ * @param[in]  x: lhs of (x * y)
+ * @param[in]  y: rhs of (x * y)
+ * @param[in]  dummy: compile switcher. in this case, T is a builtin integer.
+ * @return     true: overflow occurs by (x * y). false: no overflow
+ */
+template <typename T>
+constexpr bool occur_mul(const T& x, const T& y, std::true_type dummy) noexcept
+{
+    return overflow::occur_mul(x, y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      check overflow condition of (x * y) by comparisons and divisions.
+ * @param[in]  x: lhs of (x * y)
+ * @param[in]  y: rhs of (x * y)
+ * @param[in]  dummy: compile switcher. in this case, T is not a builtin integer.
+ * @return     true: overflow occurs by (x * y). false: no overflow
+ */
+template <typename T>
+constexpr bool occur_mul(const T& x, const T& y, std::false_type dummy) noexcept
+{
+    return (
+        ((y >   0) && ((x > (int_traits<T>::max() / y)) || (x < (int_traits<T>::min() / y)))) ||
+        ((y == -1) && (x == int_traits<T>::min())) ||
+        ((y <  -1) && ((x > (int_traits<T>::min() / y)) || (x < (int_traits<T>::max() / y))))
+    );
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      check overflow condition of (x + y).
+ *             builtin integers are checked by ken3::overflow::occur_add(),
+ *             and the others (ex. wide_int) by comparisons.
+ * @param[in]  x: lhs of (x + y)
+ * @param[in]  y: rhs of (x + y)
+ * @return     true: overflow occurs by (x + y). false: no overflow
+ */
+template <typename T>
+constexpr bool occur_add(const T& x, const T& y) noexcept
+{
+    return occur_add(x, y, std::is_integral<T>{});
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      check overflow condition of (x - y).
+ *             builtin integers are checked by ken3::overflow::occur_sub(),
+ *             and the others (ex. wide_int) by comparisons.
+ * @param[in]  x: lhs of (x - y)
+ * @param[in]  y: rhs of (x - y)
+ * @return     true: overflow occurs by (x - y). false: no overflow
+ */
+template <typename T>
+constexpr bool occur_sub(const T& x, const T& y) noexcept
+{
+    return occur_sub(x, y, std::is_integral<T>{});
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      check overflow condition of (x * y).
+ *             builtin integers are checked by ken3::overflow::occur_mul(),
+ *             and the others (ex. wide_int) by comparisons and divisions.
+ * @param[in]  x: lhs of (x * y)
+ * @param[in]  y: rhs of (x * y)
+ * @return     true: overflow occurs by (x * y). false: no overflow
+ */
+template <typename T>
+constexpr bool occur_mul(const T& x, const T& y) noexcept
+{
+    return occur_mul(x, y, std::is_integral<T>{});
+}
+/////////////////////////////////////////////////////////////////////////////
+
+#if defined(__SIZEOF_INT128__) && defined(__GNUC__) && (__GNUC__ >= 7) && !defined(__clang__)
+/**
+ * @brief      check overflow condition of (x + y) of __int128 by the builtin.
+ *             std::is_integral<__int128> is false in strict modes (ex. -std=c++11),
+ *             thus ken3::overflow does not accept it.
+ * @param[in]  x: lhs of (x + y)
+ * @param[in]  y: rhs of (x + y)
+ * @return     true: overflow occurs by (x + y). false: no overflow
+ */
+constexpr bool occur_add(const __int128& x, const __int128& y) noexcept
+{
+    return __builtin_add_overflow_p(x, y, static_cast<__int128>(0));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      check overflow condition of (x - y) of __int128 by the builtin.
+ * @param[in]  x: lhs of (x - y)
+ * @param[in]  y: rhs of (x - y)
+ * @return     true: overflow occurs by (x - y). false: no overflow
+ */
+constexpr bool occur_sub(const __int128& x, const __int128& y) noexcept
+{
+    return __builtin_sub_overflow_p(x, y, static_cast<__int128>(0));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      check overflow condition of (x * y) of __int128 by the builtin.
+ * @param[in]  x: lhs of (x * y)
+ * @param[in]  y: rhs of (x * y)
+ * @return     true: overflow occurs by (x * y). false: no overflow
+ */
+constexpr bool occur_mul(const __int128& x, const __int128& y) noexcept
+{
+    return __builtin_mul_overflow_p(x, y, static_cast<__int128>(0));
+}
+/////////////////////////////////////////////////////////////////////////////
+#endif
+
+/**
+ * @brief      calculate x + y.
+ * @param[in]  x: lhs
+ * @param[in]  y: rhs
+ * @return     x + y
+ * @throw      std::overflow_error: (x + y) makes overflow.
+ */
+template <typename T>
+constexpr T checked_add(const T& x, const T& y)
+{
+    return occur_add(x, y) ? raise_error<T>(fraction_errc::overflow) : T(x + y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate x - y.
+ * @param[in]  x: lhs
+ * @param[in]  y: rhs
+ * @return     x - y
+ * @throw      std::overflow_error: (x - y) makes overflow.
+ */
+template <typename T>
+constexpr T checked_sub(const T& x, const T& y)
+{
+    return occur_sub(x, y) ? raise_error<T>(fraction_errc::overflow) : T(x - y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate x * y.
+ * @param[in]  x: lhs
+ * @param[in]  y: rhs
+ * @return     x * y
+ * @throw      std::overflow_error: (x * y) makes overflow.
+ */
+template <typename T>
+constexpr T checked_mul(const T& x, const T& y)
+{
+    return occur_mul(x, y) ? raise_error<T>(fraction_errc::overflow) : T(x * y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      check whether x is representable in T or not.
+ * @param[in]  x: value of wider type W.
+ * @return     true: representable. false: not representable.
+ */
+template <typename T, typename W>
+constexpr bool fits(const W& x) noexcept
+{
+    return (W(int_traits<T>::min()) <= x) && (x <= W(int_traits<T>::max()));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate absolute value of x.
+ * @param[in]  x: value. should be > minimum value
+ * @return     absolute value
+ */
+template <typename T>
+constexpr T abs(const T& x) noexcept
+{
+    return (x < 0) ? T(-x) : x;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      remove trailing zero bits of x.
+ * @param[in]  x: value. should be > 0
+ * @return     odd value
+ */
+template <typename T>
+constexpr T remove_trailing_zeros(T x) noexcept
+{
+    return x >> int_traits<T>::count_trailing_zeros(x);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate gcd of two odd values by binary gcd.
+ *             the difference of odd values is even, thus its trailing
+ *             zeros are removed in each step instead of division.
+ * @param[in]  x: lhs. should be odd and > 0
+ * @param[in]  y: rhs. should be odd and > 0
+ * @return     calculated gcd.
+ */
+template <typename T>
+constexpr T gcd_odd(T x, T y) noexcept
+{
+    return (x == y) ? x : gcd_odd((x < y) ? x : y, remove_trailing_zeros(T((x < y) ? (y - x) : (x - y))));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate gcd of x and y after passing pre-coditions.
+ *             binary gcd (Stein's algorithm) is used to avoid divisions.
+ * @param[in]  x: lhs. should be > 0
+ * @param[in]  y: rhs. should be > 0
+ * @return     calculated gcd.
+ */
+template <typename T>
+constexpr T gcd_impl(T x, T y) noexcept
+{
+    return gcd_odd(remove_trailing_zeros(x), remove_trailing_zeros(y)) << int_traits<T>::count_trailing_zeros(T(x | y));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate gcd of x and y.
+ * @param[in]  x: lhs. should be from numerator. if negative, then std::abs(lhs) is used
+ * @param[in]  y: rhs. should be from denominator (> 0)
+ * @return     calculated gcd.
+ *             if one of x or y is 0, return 1.
+ *             (x=100, y=15) => (gcd=5)
+ *             (x=-100, y=15) => (gcd=5)
+ *             (x=0, y=15) => (gcd=1)
+ *             (x=min, y=15) => (gcd=1)
+ *             (x=min, y=2) => (gcd=2)
+ * @note       std::abs(min) makes overflow, but gcd(|min|, y) == gcd(|min| - y, y).
+ *             before binary gcd, gcd(min, y) was always 1, thus fraction(min, 6)
+ *             was not reduced. now it is reduced to (min / 2, 3).
+ */
+template <typename T>
+constexpr T gcd(const T& x, const T& y) noexcept
+{
+    return (x == 0) ? T(1) :
+           (x > 0) ? gcd_impl(x, y) :
+           (x == int_traits<T>::min()) ? gcd_impl(T(-(x + y)), y) :
+           gcd_impl(T(-x), y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate gcd of x and negative y.
+ * @param[in]  x: lhs. should be != 0 and != y
+ * @param[in]  y: rhs. should be < 0
+ * @return     calculated gcd.
+ *             (x=min, y=-6) => (gcd=2)
+ *             (x=3, y=min) => (gcd=1)
+ */
+template <typename T>
+constexpr T gcd_negative(const T& x, const T& y) noexcept
+{
+    return (y > int_traits<T>::min()) ? gcd(x, T(-y)) : gcd(y, abs(x));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      negate numerator and denominator, which are divided by g.
+ * @param[in]  numerator: numerator.
+ * @param[in]  denominator: denominator (< 0).
+ * @param[in]  g: gcd of numerator and denominator.
+ * @return     pair of reduced numerator and denominator (> 0).
+ */
+template <typename T>
+constexpr std::pair<T, T> negate_divide(const T& numerator, const T& denominator, const T& g) noexcept
+{
+    return std::pair<T, T>(-(numerator / g), -(denominator / g));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      check the error of normalize().
+ * @param[in]  numerator: appointed numerator.
+ * @param[in]  denominator: appointed denominator.
+ * @return     fraction_errc::zero_denominator: denominator == 0.
+ *             fraction_errc::overflow: std::abs(minimum value) is required
+ *             even after reduction. (ex. (min, -1), (1, min))
+ *             fraction_errc::ok: otherwise.
+ */
+template <typename T>
+constexpr fraction_errc normalize_error(const T& numerator, const T& denominator) noexcept
+{
+    using limit = int_traits<T>;
+
+    return (denominator > 0) ? fraction_errc::ok :
+           (denominator == 0) ? fraction_errc::zero_denominator :
+           ((numerator == 0) || (numerator == denominator)) ? fraction_errc::ok :
+           (((numerator == limit::min()) || (denominator == limit::min())) &&
+            (gcd_negative(numerator, denominator) == 1)) ? fraction_errc::overflow :
+           fraction_errc::ok;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      make the denominator positive.
+ *             a negative denominator is divided by gcd before negation,
+ *             thus minimum values are allowed if the gcd is > 1.
+ * @param[in]  numerator: appointed numerator.
+ * @param[in]  denominator: appointed denominator.
+ * @return     pair of numerator and denominator (> 0).
+ *             (min, -6) => (2^62 / 3, 1) in case of 64 bits.
+ * @throw      std::runtime_error: denominator == 0.
+ *             std::overflow_error: std::abs(minimum value) is required
+ *             even after reduction.
+ */
+template <typename T>
+constexpr std::pair<T, T> normalize(const T& numerator, const T& denominator)
+{
+    using pair_type = std::pair<T, T>;
+
+    return (denominator > 0) ? pair_type(numerator, denominator) :
+           (normalize_error(numerator, denominator) != fraction_errc::ok) ?
+               raise_error<pair_type>(normalize_error(numerator, denominator)) :
+           (numerator == 0) ? pair_type(0, 1) :
+           (numerator == denominator) ? pair_type(1, 1) :
+           negate_divide(numerator, denominator, gcd_negative(numerator, denominator));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      divide numerator and denominator by their gcd.
+ * @param[in]  numerator: numerator.
+ * @param[in]  denominator: denominator (> 0).
+ * @param[in]  g: gcd of numerator and denominator.
+ * @return     pair of reduced numerator and denominator.
+ */
+template <typename T>
+constexpr std::pair<T, T> divide(const T& numerator, const T& denominator, const T& g) noexcept
+{
+    return std::pair<T, T>(numerator / g, denominator / g);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      reduce. (ex. 2/4 -> 1/2)
+ * @param[in]  f: pair of numerator and denominator (> 0).
+ * @return     pair of reduced numerator and denominator.
+ */
+template <typename T>
+constexpr std::pair<T, T> reduce(const std::pair<T, T>& f) noexcept
+{
+    return (f.first == 0) ? std::pair<T, T>(0, 1) : divide(f.first, f.second, gcd(f.first, f.second));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      compare a/b and c/d by cross multiplication in wider type.
+ * @param[in]  a: numerator of lhs
+ * @param[in]  b: denominator of lhs (> 0)
+ * @param[in]  c: numerator of rhs
+ * @param[in]  d: denominator of rhs (> 0)
+ * @tparam     W: wider type, which holds the product of two T.
+ * @return     true: a/b < c/d. false: otherwise.
+ */
+template <typename W, typename T>
+constexpr bool less_by_product(const T& a, const T& b, const T& c, const T& d) noexcept
+{
+    return (W(a) * W(d)) < (W(c) * W(b));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate the remainder of floor division. the result is in [0, y).
+ * @param[in]  x: dividend
+ * @param[in]  y: divisor (> 0)
+ * @return     remainder
+ */
+template <typename T>
+constexpr T floor_mod(const T& x, const T& y) noexcept
+{
+    return ((x % y) < 0) ? T((x % y) + y) : T(x % y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate floor division.
+ * @param[in]  x: dividend
+ * @param[in]  y: divisor (> 0)
+ * @return     quotient
+ */
+template <typename T>
+constexpr T floor_div(const T& x, const T& y) noexcept
+{
+    return ((x % y) < 0) ? T((x / y) - 1) : T(x / y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+constexpr bool less_by_parts(const T& a, const T& b, const T& c, const T& d) noexcept;
+
+/**
+ * @brief      compare a/b and c/d, whose integer parts are same, by decimal parts.
+ * @param[in]  b: denominator of lhs (> 0)
+ * @param[in]  ra: decimal part of numerator of lhs, in [0, b)
+ * @param[in]  d: denominator of rhs (> 0)
+ * @param[in]  rc: decimal part of numerator of rhs, in [0, d)
+ * @return     true: a/b < c/d. false: otherwise.
+ */
+template <typename T>
+constexpr bool less_decimal(const T& b, const T& ra, const T& d, const T& rc) noexcept
+{
+    // ra/b < rc/d means d/rc < b/ra
+    return (ra == 0) ? (rc != 0) :
+           (rc == 0) ? false :
+           less_by_parts(d, rc, b, ra);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      compare a/b and c/d by integer parts and decimal parts, without
+ *             overflow. it is used when there is no wider type.
+ * @param[in]  a: numerator of lhs
+ * @param[in]  b: denominator of lhs (> 0)
+ * @param[in]  c: numerator of rhs
+ * @param[in]  d: denominator of rhs (> 0)
+ * @return     true: a/b < c/d. false: otherwise.
+ */
+template <typename T>
+constexpr bool less_by_parts(const T& a, const T& b, const T& c, const T& d) noexcept
+{
+    return (floor_div(a, b) != floor_div(c, d)) ? (floor_div(a, b) < floor_div(c, d)) :
+           less_decimal(b, floor_mod(a, b), d, floor_mod(c, d));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      count bits to represent x.
+ * @param[in]  x: value
+ * @return     0 for 0, otherwise the position of the highest set bit + 1.
+ */
+constexpr int bit_width(unsigned long long x) noexcept
+{
+#if defined(__GNUC__)
+    return (x == 0) ? 0 : (static_cast<int>(sizeof(x) * CHAR_BIT) - __builtin_clzll(x));
+#else
+    return (x == 0) ? 0 : (1 + bit_width(x >> 1));
+#endif
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      decompose finite x into the sign, the odd mantissa and the
+ *             exponent by std::frexp. |x| == mantissa * 2^exponent.
+ * @param[in]  x: finite value
+ * @param[out] negative: true: x < 0. false: x >= 0
+ * @param[out] exponent: exponent of 2
+ * @return     mantissa. odd and < 2^53, or 0 for x == 0.
+ */
+inline long long decompose(double x, bool& negative, int& exponent) noexcept
+{
+    int e = 0;
+    const double m = std::fabs(std::frexp(x, &e));
+    const long long mantissa = static_cast<long long>(std::ldexp(m, std::numeric_limits<double>::digits));
+    negative = (x < 0);
+    if (mantissa == 0) {
+        exponent = 0;
+        return 0;
+    }
+    const int zeros = int_traits<long long>::count_trailing_zeros(mantissa);
+    exponent = e - std::numeric_limits<double>::digits + zeros;
+    return mantissa >> zeros;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate floor division and its remainder for continued fractions.
+ *             if n and d fit T, they are divided in T. otherwise, the quotient
+ *             is estimated in double and corrected by the remainder, because
+ *             division of the wider type is much slower than multiplication.
+ * @param[in]  n: dividend
+ * @param[in]  d: divisor (> 0)
+ * @param[out] r: remainder in [0, d)
+ * @return     quotient
+ */
+template <typename T, typename W>
+W floor_divide(const W& n, const W& d, W& r)
+{
+    if (fits<T>(n) && fits<T>(d)) {
+        r = W(floor_mod(T(n), T(d)));
+        return W(floor_div(T(n), T(d)));
+    }
+    const double estimate = std::floor(static_cast<double>(n) / static_cast<double>(d));
+    if (std::fabs(estimate) >= 4503599627370496.0) {
+        r = floor_mod(n, d);
+        return floor_div(n, d);
+    }
+    W q = W(static_cast<long long>(estimate));
+    r = n - q * d;
+    for ( ; r < 0; r = r + d) {
+        q = q - 1;
+    }
+    for ( ; r >= d; r = r - d) {
+        q = q + 1;
+    }
+    return q;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate x + a * y with checking overflow.
+ * @param[in]  x: addend
+ * @param[in]  a: multiplier
+ * @param[in]  y: multiplicand
+ * @param[in]  dummy: compile switcher. in this case, intermediates are checked.
+ * @return     x + a * y
+ * @throw      std::overflow_error: when overflow occurs.
+ */
+template <typename W>
+W multiply_add(const W& x, const W& a, const W& y, std::true_type dummy)
+{
+    return checked_add(x, checked_mul(a, y));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate x + a * y in the wider type, which never makes overflow.
+ * @param[in]  x: addend
+ * @param[in]  a: multiplier
+ * @param[in]  y: multiplicand
+ * @param[in]  dummy: compile switcher. in this case, intermediates are not checked.
+ * @return     x + a * y
+ */
+template <typename W>
+W multiply_add(const W& x, const W& a, const W& y, std::false_type dummy) noexcept
+{
+    return x + a * y;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      find the closest fraction to n/d whose denominator is <= limit
+ *             by continued fractions. it is same as limit_denominator() of
+ *             Python's fractions.Fraction.
+ * @param[in]  n: numerator
+ * @param[in]  d: denominator (> limit). n/d should be reduced.
+ * @param[in]  limit: maximum denominator (>= 1)
+ * @tparam     T: narrower type, which holds limit. see floor_divide().
+ *             if W is wider than T, |n/d| should be < 2^(bits of T - 1),
+ *             then numerators are < 2^(2 * (bits of T - 1)) and fit W.
+ * @return     pair of reduced numerator and denominator.
+ * @throw      std::overflow_error: the numerator does not fit W.
+ */
+template <typename T, typename W>
+std::pair<W, W> limit_denominator(W n, W d, const W& limit)
+{
+    using checked = std::is_same<T, W>;
+
+    const W original = d;
+    W p0 = 0;
+    W q0 = 1;
+    W p1 = 1;
+    W q1 = 0;
+    for (;;) {
+        W r = 0;
+        const W a = floor_divide<T>(n, d, r);
+        // q2 = q0 + a * q1 > limit
+        if ((q1 != 0) && (a > W(T(limit - q0) / T(q1)))) {
+            break;
+        }
+        const W p2 = multiply_add(p0, a, p1, checked{});
+        const W q2 = q0 + a * q1;
+        p0 = p1;
+        q0 = q1;
+        p1 = p2;
+        q1 = q2;
+        n = d;
+        d = r;
+    }
+
+    // the distance between p1/q1 and the other candidate is 1/(q1*(q0+k*q1)),
+    // and the distance between p1/q1 and n/d is d/(q1*original).
+    const W k = W(T(limit - q0) / T(q1));
+    if (W(2) * (q0 + k * q1) <= original / d) {
+        return std::pair<W, W>(p1, q1);
+    }
+    return std::pair<W, W>(multiply_add(p0, k, p1, checked{}), W(q0 + k * q1));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct  search_type
+ * @brief   type to find the closest fraction of double for T. W is widened
+ *          until it holds all bits of x which can change the result, that is
+ *          2^-(bits of W - 2) <= 2^-(bits of T + 53). less bits of x are
+ *          rounded, because then the result is 0 anyway. if there is no such
+ *          type (ex. T is __int128), type is the widest one.
+ */
+template <typename T, typename W,
+          bool = ((sizeof(W) >= sizeof(T) + 7) || std::is_void<typename int_traits<W>::wider_type>::value)>
+struct search_type
+{
+    using type = W;
+};
+
+template <typename T, typename W>
+struct search_type<T, W, false>
+{
+    using type = typename search_type<T, typename int_traits<W>::wider_type>::type;
+};
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace fraction_detail {
+
+/**
+ * @class   basic_fraction
  * @brief   fraction class consists of two integers. The one is numerator, the
- *          other is denominator. The denominator is always > 0. Integer type
- *          for both is std::intmax_t.
+ *          other is denominator. The denominator is always > 0.
+ * @tparam  IntT: integer type for both. signed integer, __int128, or ken3::wide_int.
  */
-class fraction
+template <typename IntT>
+class basic_fraction
 {
 public:
-    using int_type = std::intmax_t;
+    using int_type = IntT;
     using pair_type = std::pair<int_type, int_type>;
+private:
+    using self_type = basic_fraction<IntT>;
+    using traits = fraction_detail::int_traits<IntT>;
+    using wider_type = typename traits::wider_type;
+    using has_wider = std::integral_constant<bool, not std::is_void<wider_type>::value>;
+    using work_type = typename std::conditional<has_wider::value, wider_type, int_type>::type;
     /////////////////////////////////////////////////////////////////////////////
 
 public:
@@ -44,7 +894,7 @@ public:
      * @brief      default constructor.
      *             fraction 0/1 is constructed.
      */
-    fraction() noexcept = default;
+    basic_fraction() noexcept = default;
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -54,18 +904,22 @@ public:
      * @throw      std::runtime_error: denominator == 0, or
      *                                 std::abs(minimum value) is required.
      */
-    fraction(int_type numerator, int_type denominator);
+    constexpr basic_fraction(int_type numerator, int_type denominator):
+        basic_fraction(fraction_detail::reduce(fraction_detail::normalize(numerator, denominator)))
+    {
+        ;
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
      * @brief      copy constructor, move constructor, destructor, copy operator=,
      *             and move operator= are nothing special.
      */
-    fraction(const fraction& src) noexcept = default;
-    fraction(fraction&& src) noexcept = default;
-    ~fraction(void) noexcept = default;
-    fraction& operator=(const fraction& rhs) noexcept = default;
-    fraction& operator=(fraction&& rhs) noexcept = default;
+    basic_fraction(const self_type& src) noexcept = default;
+    basic_fraction(self_type&& src) noexcept = default;
+    ~basic_fraction(void) noexcept = default;
+    self_type& operator=(const self_type& rhs) noexcept = default;
+    self_type& operator=(self_type&& rhs) noexcept = default;
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -73,7 +927,10 @@ public:
      * @param[in]  rhs: right hand side of operator==
      * @return     result of operator==
      */
-    bool operator==(const fraction& rhs) const noexcept;
+    constexpr bool operator==(const self_type& rhs) const noexcept
+    {
+        return (numerator_ == rhs.numerator_) && (denominator_ == rhs.denominator_);
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -81,15 +938,24 @@ public:
      * @param[in]  rhs: right hand side of operator!=
      * @return     result of operator!=
      */
-    bool operator!=(const fraction& rhs) const noexcept;
+    constexpr bool operator!=(const self_type& rhs) const noexcept
+    {
+        return not (*this == rhs);
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
      * @brief      operator<
+     *             numerators are compared after cross multiplication in the
+     *             wider type. without the wider type, integer parts and
+     *             decimal parts are compared. both are exact without overflow.
      * @param[in]  rhs: right hand side of operator<
      * @return     result of operator<
      */
-    bool operator<(const fraction& rhs) const noexcept;
+    constexpr bool operator<(const self_type& rhs) const noexcept
+    {
+        return less(rhs, has_wider{});
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -97,7 +963,10 @@ public:
      * @param[in]  rhs: right hand side of operator>
      * @return     result of operator>
      */
-    bool operator>(const fraction& rhs) const noexcept;
+    constexpr bool operator>(const self_type& rhs) const noexcept
+    {
+        return (rhs < *this);
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -105,7 +974,10 @@ public:
      * @param[in]  rhs: right hand side of operator<=
      * @return     result of operator<=
      */
-    bool operator<=(const fraction& rhs) const noexcept;
+    constexpr bool operator<=(const self_type& rhs) const noexcept
+    {
+        return not (*this > rhs);
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -113,7 +985,10 @@ public:
      * @param[in]  rhs: right hand side of operator>=
      * @return     result of operator>=
      */
-    bool operator>=(const fraction& rhs) const noexcept;
+    constexpr bool operator>=(const self_type& rhs) const noexcept
+    {
+        return not (*this < rhs);
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -122,7 +997,11 @@ public:
      * @return     result of operator+=
      * @throw      std::overflow_error: when overflow occurs.
      */
-    fraction& operator+=(const fraction& rhs);
+    self_type& operator+=(const self_type& rhs)
+    {
+        fraction_detail::check_error(try_add(rhs));
+        return *this;
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -131,7 +1010,11 @@ public:
      * @return     result of operator-=
      * @throw      std::overflow_error: when overflow occurs.
      */
-    fraction& operator-=(const fraction& rhs);
+    self_type& operator-=(const self_type& rhs)
+    {
+        fraction_detail::check_error(try_sub(rhs));
+        return *this;
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -140,7 +1023,11 @@ public:
      * @return     result of operator*=
      * @throw      std::overflow_error: when overflow occurs.
      */
-    fraction& operator*=(const fraction& rhs);
+    self_type& operator*=(const self_type& rhs)
+    {
+        fraction_detail::check_error(try_mul(rhs));
+        return *this;
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -150,7 +1037,11 @@ public:
      * @throw      std::overflow_error: when overflow occurs.
      *             std::runtime_error: numerator of rhs == 0.
      */
-    fraction& operator/=(const fraction& rhs);
+    self_type& operator/=(const self_type& rhs)
+    {
+        fraction_detail::check_error(try_div(rhs));
+        return *this;
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -159,7 +1050,10 @@ public:
      * @return     result of operator+
      * @throw      std::overflow_error: when overflow occurs.
      */
-    const fraction operator+(const fraction& rhs) const;
+    constexpr const self_type operator+(const self_type& rhs) const
+    {
+        return add(rhs, fraction_detail::gcd(denominator_, rhs.denominator_), has_wider{});
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -168,7 +1062,10 @@ public:
      * @return     result of operator-
      * @throw      std::overflow_error: when overflow occurs.
      */
-    const fraction operator-(const fraction& rhs) const;
+    constexpr const self_type operator-(const self_type& rhs) const
+    {
+        return sub(rhs, fraction_detail::gcd(denominator_, rhs.denominator_), has_wider{});
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -177,7 +1074,11 @@ public:
      * @return     result of operator*
      * @throw      std::overflow_error: when overflow occurs.
      */
-    const fraction operator*(const fraction& rhs) const;
+    constexpr const self_type operator*(const self_type& rhs) const
+    {
+        return mul(rhs, fraction_detail::gcd(numerator_, rhs.denominator_),
+                   fraction_detail::gcd(rhs.numerator_, denominator_), has_wider{});
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -187,88 +1088,171 @@ public:
      * @throw      std::overflow_error: when overflow occurs.
      *             std::runtime_error: numerator of rhs == 0.
      */
-    const fraction operator/(const fraction& rhs) const;
+    constexpr const self_type operator/(const self_type& rhs) const
+    {
+        return (rhs.numerator_ != traits::min()) ?
+                   (*this * self_type(rhs.denominator_, rhs.numerator_)) :
+                   div_min(rhs, has_wider{});
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
-     * @brief      cast to std::intmax_t
-     * @return     casted std::intmax_t
+     * @brief      make fraction without exceptions.
+     * @param[in]  numerator: appointed numerator.
+     * @param[in]  denominator: appointed denominator.
+     * @param[out] result: the fraction. it is not changed if an error occurs.
+     * @return     fraction_errc::ok: success.
+     *             fraction_errc::zero_denominator: denominator == 0.
+     *             fraction_errc::overflow: std::abs(minimum value) is required.
      */
-    operator int_type(void) const noexcept;
+    static fraction_errc try_make(int_type numerator, int_type denominator, self_type& result) noexcept
+    {
+        const fraction_errc e = fraction_detail::normalize_error(numerator, denominator);
+        if (e == fraction_errc::ok) {
+            result = self_type(fraction_detail::reduce(fraction_detail::normalize(numerator, denominator)));
+        }
+        return e;
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
-     * @brief      cast to float
-     * @return     casted float
+     * @brief      operator+= without exceptions.
+     * @param[in]  rhs: right hand side of operator+=
+     * @return     fraction_errc::ok: success.
+     *             fraction_errc::overflow: *this is not changed.
      */
-    operator float(void) const noexcept;
+    fraction_errc try_add(const self_type& rhs) noexcept
+    {
+        return try_add(rhs, rhs.numerator_, has_wider{});
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
-     * @brief      cast to double
-     * @return     casted double
+     * @brief      operator-= without exceptions.
+     * @param[in]  rhs: right hand side of operator-=
+     * @return     fraction_errc::ok: success.
+     *             fraction_errc::overflow: *this is not changed.
      */
-    operator double(void) const noexcept;
+    fraction_errc try_sub(const self_type& rhs) noexcept
+    {
+        return try_sub(rhs, has_wider{});
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
-     * @brief      cast to long double
-     * @return     casted long double
+     * @brief      operator*= without exceptions.
+     * @param[in]  rhs: right hand side of operator*=
+     * @return     fraction_errc::ok: success.
+     *             fraction_errc::overflow: *this is not changed.
      */
-    operator long double(void) const noexcept;
+    fraction_errc try_mul(const self_type& rhs) noexcept
+    {
+        return try_mul(rhs, has_wider{});
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
-     * @brief      operator>> for in-stream
-     * @param[in,out] is: in-stream
-     * @param[out] self: derived value from in-stream are set
-     * @return     argument in-stream
-     * @throw      std::runtime_error: new denominator == 0, or
-     *                                 std::abs(minimum value) is required.
-     * @note       the format of fraction is "1/2" when numerator is 1 and
-     *             denominator is 2.
+     * @brief      operator/= without exceptions.
+     * @param[in]  rhs: right hand side of operator/=
+     * @return     fraction_errc::ok: success.
+     *             fraction_errc::zero_denominator: numerator of rhs == 0.
+     *             fraction_errc::overflow: when overflow occurs.
+     *             *this is not changed if an error occurs.
+     */
+    fraction_errc try_div(const self_type& rhs) noexcept
+    {
+        if (rhs.numerator_ == 0) {
+            return fraction_errc::zero_denominator;
+        }
+        else if (rhs.numerator_ != traits::min()) {
+            // the inverse of reduced rhs is also reduced
+            return try_mul((rhs.numerator_ < 0) ? self_type(pair_type(-rhs.denominator_, -rhs.numerator_)) :
+                                                  self_type(pair_type(rhs.denominator_, rhs.numerator_)));
+        }
+        return try_div_min(rhs, has_wider{});
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      cast to int_type
+     * @return     casted int_type
+     */
+    constexpr operator int_type(void) const noexcept
+    {
+        return numerator_ / denominator_;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      cast to float
+     * @return     casted float
+     */
+    constexpr operator float(void) const noexcept
+    {
+        return (float)numerator_ / (float)denominator_;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      cast to double
+     * @return     casted double
      */
-    friend std::istream& operator>>(std::istream& is, fraction& self);
+    constexpr operator double(void) const noexcept
+    {
+        return (double)numerator_ / (double)denominator_;
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
-     * @brief      operator<< for out-stream
-     * @param[in,out] os: out-stream
-     * @param[in]  self: input for out-stream
-     * @return     argument out-stream
-     * @note       the format of fraction is "1/2" when numerator is 1 and
-     *             denominator is 2.
+     * @brief      cast to long double
+     * @return     casted long double
      */
-    friend std::ostream& operator<<(std::ostream& os, const fraction& self);
+    constexpr operator long double(void) const noexcept
+    {
+        return (long double)numerator_ / (long double)denominator_;
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
      * @brief      swap two fractions
      * @param[in,out] rhs: counter part of swap
      */
-    void swap(fraction& rhs) noexcept;
+    void swap(self_type& rhs) noexcept
+    {
+        std::swap(numerator_, rhs.numerator_);
+        std::swap(denominator_, rhs.denominator_);
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
      * @brief      operator(). getter of numerator and denominator.
-     * @return     std::pair<std::intmax_t, std::intmax_t>. The first is numerator
+     * @return     std::pair<int_type, int_type>. The first is numerator
      *             and second is denominator.
      */
-    pair_type operator()(void) const noexcept;
+    constexpr pair_type operator()(void) const noexcept
+    {
+        return pair_type{numerator_, denominator_};
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
      * @brief      getter of numerator.
      * @return     numerator
      */
-    int_type numerator(void) const noexcept;
+    constexpr int_type numerator(void) const noexcept
+    {
+        return numerator_;
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
      * @brief      getter of denominator.
      * @return     denominator
      */
-    int_type denominator(void) const noexcept;
+    constexpr int_type denominator(void) const noexcept
+    {
+        return denominator_;
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -278,7 +1262,10 @@ public:
      * @throw      std::runtime_error: new denominator == 0, or
      *                                 std::abs(minimum value) is required.
      */
-    void set(int_type numerator, int_type denominator);
+    void set(int_type numerator, int_type denominator)
+    {
+        *this = self_type(numerator, denominator);
+    }
     /////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -286,14 +1273,575 @@ public:
      * @throw      std::runtime_error: new denominator == 0, or
      *                                 std::abs(minimum value) is required.
      */
-    void inverse(void);
+    void inverse(void)
+    {
+        *this = self_type(denominator_, numerator_);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      find the closest fraction whose denominator is <= max_denominator.
+     *             it is same as limit_denominator() of Python's fractions.Fraction.
+     * @param[in]  max_denominator: maximum denominator (>= 1)
+     * @return     the closest fraction. if two are same distance, the one
+     *             with smaller denominator.
+     * @throw      std::invalid_argument: max_denominator < 1.
+     */
+    self_type limit_denominator(int_type max_denominator) const
+    {
+        if (max_denominator < 1) {
+            fraction_detail::raise_error(fraction_errc::invalid_argument, "max_denominator should be >= 1");
+        }
+        if (denominator_ <= max_denominator) {
+            return *this;
+        }
+        return narrow(fraction_detail::limit_denominator<int_type>(work_type(numerator_), work_type(denominator_),
+                                                         work_type(max_denominator)));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      make the fraction which is exactly same as x.
+     *             x is decomposed into mantissa * 2^exponent by std::frexp.
+     * @param[in]  x: value
+     * @return     fraction. (ex. 0.375 -> 3/8)
+     * @throw      std::domain_error: x is infinity or NaN.
+     *             std::overflow_error: x is not representable. (ex. 1e-30 -> 2^-100 * mantissa)
+     */
+    static self_type from_double(double x)
+    {
+        const int digits = static_cast<int>(sizeof(int_type) * CHAR_BIT) - 1;
+        bool negative = false;
+        int exponent = 0;
+        const long long mantissa = fraction_detail::decompose(finite(x), negative, exponent);
+        const int width = fraction_detail::bit_width(static_cast<unsigned long long>(mantissa));
+
+        if (mantissa == 0) {
+            return self_type();
+        }
+        else if (negative && (mantissa == 1) && (exponent == digits)) {
+            return self_type(pair_type(traits::min(), 1));
+        }
+        else if ((width > digits) || (exponent + width > digits) || (-exponent > digits - 1)) {
+            fraction_detail::raise_error(fraction_errc::overflow);
+        }
+        const int_type magnitude = (exponent > 0) ? int_type(int_type(mantissa) << exponent) : int_type(mantissa);
+        const int_type denominator = (exponent < 0) ? int_type(int_type(1) << -exponent) : int_type(1);
+        return self_type(pair_type(negative ? int_type(-magnitude) : magnitude, denominator));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      find the closest fraction to x whose denominator is <= max_denominator.
+     *             it is same as from_double(x).limit_denominator(max_denominator),
+     *             but x is not required to be representable. the search is done
+     *             in fraction_detail::search_type, and bits of x less than
+     *             2^-(bits of the type - 1) are rounded before the search.
+     * @param[in]  x: value
+     * @param[in]  max_denominator: maximum denominator (>= 1)
+     * @return     the closest fraction. (ex. (3.14159, 100) -> 311/99)
+     *             if there is no type wide enough (ex. int_type is __int128, or
+     *             int without __int128), the result may not be the closest for
+     *             tiny x, because of the rounding.
+     * @throw      std::domain_error: x is infinity or NaN.
+     *             std::invalid_argument: max_denominator < 1.
+     *             std::overflow_error: the result is not representable.
+     */
+    static self_type from_double(double x, int_type max_denominator)
+    {
+        using search_type = typename fraction_detail::search_type<int_type, work_type>::type;
+        const int digits = static_cast<int>(sizeof(int_type) * CHAR_BIT) - 1;
+        const int max_shift = static_cast<int>(sizeof(search_type) * CHAR_BIT) - 2;
+        bool negative = false;
+        int exponent = 0;
+        long long mantissa = fraction_detail::decompose(finite(x), negative, exponent);
+
+        if (max_denominator < 1) {
+            fraction_detail::raise_error(fraction_errc::invalid_argument, "max_denominator should be >= 1");
+        }
+        else if (exponent >= 0) {
+            return from_double(x);
+        }
+        else if (std::fabs(x) >= std::ldexp(1.0, digits)) {
+            fraction_detail::raise_error(fraction_errc::overflow);
+        }
+        else if (-exponent > max_shift) {
+            const int shift = -exponent - max_shift;
+            mantissa = (shift > 62) ? 0 : (((mantissa >> (shift - 1)) + 1) >> 1);
+            if (mantissa == 0) {
+                return self_type();
+            }
+            const int zeros = fraction_detail::int_traits<long long>::count_trailing_zeros(mantissa);
+            mantissa >>= zeros;
+            exponent = zeros - max_shift;
+        }
+        const search_type numerator = negative ? search_type(-mantissa) : search_type(mantissa);
+        const search_type denominator = search_type(1) << -exponent;
+        if (denominator <= search_type(max_denominator)) {
+            return narrow(std::pair<search_type, search_type>(numerator, denominator));
+        }
+        return narrow(fraction_detail::limit_denominator<int_type>(numerator, denominator,
+                                                                   search_type(max_denominator)));
+    }
     /////////////////////////////////////////////////////////////////////////////
 
 private:
     /**
-     * @brief      reduce. (ex. 2/4 -> 1/2)
+     * @brief      check x is finite.
+     * @param[in]  x: value
+     * @return     x
+     * @throw      std::domain_error: x is infinity or NaN.
+     */
+    static double finite(double x)
+    {
+        if (not std::isfinite(x)) {
+            fraction_detail::raise_error(fraction_errc::domain_error);
+        }
+        return x;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    /**
+     * @brief      constructor with reduced numerator and denominator.
+     * @param[in]  reduced: pair of reduced numerator and denominator (> 0).
+     */
+    constexpr explicit basic_fraction(const pair_type& reduced) noexcept:
+        numerator_(reduced.first), denominator_(reduced.second)
+    {
+        ;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      make fraction from reduced numerator and denominator of wider type.
+     * @param[in]  reduced: pair of reduced numerator and denominator (> 0).
+     * @return     fraction
+     * @throw      std::overflow_error: numerator or denominator does not fit int_type.
+     */
+    template <typename W>
+    static constexpr self_type narrow(const std::pair<W, W>& reduced)
+    {
+        return (fraction_detail::fits<int_type>(reduced.first) && fraction_detail::fits<int_type>(reduced.second)) ?
+                   self_type(pair_type(int_type(reduced.first), int_type(reduced.second))) :
+                   fraction_detail::raise_error<self_type>(fraction_errc::overflow);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      make fraction from numerator and denominator of wider type.
+     *             if both fit int_type, they are reduced in int_type.
+     * @param[in]  numerator: numerator.
+     * @param[in]  denominator: denominator (> 0).
+     * @return     fraction
+     * @throw      std::overflow_error: reduced result does not fit int_type.
+     */
+    template <typename W>
+    static constexpr self_type from_wider(const W& numerator, const W& denominator)
+    {
+        return (fraction_detail::fits<int_type>(numerator) && fraction_detail::fits<int_type>(denominator)) ?
+                   self_type(int_type(numerator), int_type(denominator)) :
+                   narrow(fraction_detail::reduce(std::pair<W, W>(numerator, denominator)));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      make fraction from numerator and denominator, which are coprime.
+     * @param[in]  numerator: numerator.
+     * @param[in]  denominator: denominator (> 0).
+     * @return     fraction
+     */
+    static constexpr self_type from_coprime(const int_type& numerator, const int_type& denominator) noexcept
+    {
+        return (numerator == 0) ? self_type() : self_type(pair_type(numerator, denominator));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator< by cross multiplication in the wider type.
+     * @param[in]  rhs: right hand side of operator<
+     * @param[in]  dummy: compile switcher. in this case, there is the wider type.
+     * @return     result of operator<
+     */
+    constexpr bool less(const self_type& rhs, std::true_type dummy) const noexcept
+    {
+        return fraction_detail::less_by_product<wider_type>(numerator_, denominator_, rhs.numerator_, rhs.denominator_);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator< by integer parts and decimal parts.
+     * @param[in]  rhs: right hand side of operator<
+     * @param[in]  dummy: compile switcher. in this case, there is no wider type.
+     * @return     result of operator<
+     */
+    constexpr bool less(const self_type& rhs, std::false_type dummy) const noexcept
+    {
+        return fraction_detail::less_by_parts(numerator_, denominator_, rhs.numerator_, rhs.denominator_);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator+ in the wider type.
+     * @param[in]  rhs: right hand side of operator+
+     * @param[in]  g: gcd of both denominators.
+     * @param[in]  dummy: compile switcher. in this case, there is the wider type.
+     * @return     result of operator+
+     * @throw      std::overflow_error: when overflow occurs.
+     */
+    constexpr self_type add(const self_type& rhs, const int_type& g, std::true_type dummy) const
+    {
+        return from_wider(wider_type(numerator_) * wider_type(rhs.denominator_ / g) +
+                          wider_type(rhs.numerator_) * wider_type(denominator_ / g),
+                          wider_type(denominator_ / g) * wider_type(rhs.denominator_));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator+ with checking each intermediate.
+     * @param[in]  rhs: right hand side of operator+
+     * @param[in]  g: gcd of both denominators.
+     * @param[in]  dummy: compile switcher. in this case, there is no wider type.
+     * @return     result of operator+
+     * @throw      std::overflow_error: when overflow occurs.
+     */
+    constexpr self_type add(const self_type& rhs, const int_type& g, std::false_type dummy) const
+    {
+        using namespace fraction_detail;
+
+        return self_type(checked_add(checked_mul(numerator_, int_type(rhs.denominator_ / g)),
+                                     checked_mul(rhs.numerator_, int_type(denominator_ / g))),
+                         checked_mul(int_type(denominator_ / g), rhs.denominator_));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator- in the wider type.
+     * @param[in]  rhs: right hand side of operator-
+     * @param[in]  g: gcd of both denominators.
+     * @param[in]  dummy: compile switcher. in this case, there is the wider type.
+     * @return     result of operator-
+     * @throw      std::overflow_error: when overflow occurs.
+     */
+    constexpr self_type sub(const self_type& rhs, const int_type& g, std::true_type dummy) const
+    {
+        return from_wider(wider_type(numerator_) * wider_type(rhs.denominator_ / g) -
+                          wider_type(rhs.numerator_) * wider_type(denominator_ / g),
+                          wider_type(denominator_ / g) * wider_type(rhs.denominator_));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator- with checking each intermediate.
+     * @param[in]  rhs: right hand side of operator-
+     * @param[in]  g: gcd of both denominators.
+     * @param[in]  dummy: compile switcher. in this case, there is no wider type.
+     * @return     result of operator-
+     * @throw      std::overflow_error: when overflow occurs.
+     */
+    constexpr self_type sub(const self_type& rhs, const int_type& g, std::false_type dummy) const
+    {
+        using namespace fraction_detail;
+
+        return self_type(checked_sub(checked_mul(numerator_, int_type(rhs.denominator_ / g)),
+                                     checked_mul(rhs.numerator_, int_type(denominator_ / g))),
+                         checked_mul(int_type(denominator_ / g), rhs.denominator_));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator* in the wider type. the result of cross reduction
+     *             is already reduced, thus it is only checked to fit int_type.
+     * @param[in]  rhs: right hand side of operator*
+     * @param[in]  gcd14: gcd of numerator of lhs and denominator of rhs.
+     * @param[in]  gcd23: gcd of numerator of rhs and denominator of lhs.
+     * @param[in]  dummy: compile switcher. in this case, there is the wider type.
+     * @return     result of operator*
+     * @throw      std::overflow_error: when overflow occurs.
+     */
+    constexpr self_type mul(const self_type& rhs, const int_type& gcd14, const int_type& gcd23,
+                            std::true_type dummy) const
+    {
+        return ((numerator_ == 0) || (rhs.numerator_ == 0)) ? self_type() :
+               narrow(std::pair<wider_type, wider_type>(
+                   wider_type(numerator_ / gcd14) * wider_type(rhs.numerator_ / gcd23),
+                   wider_type(denominator_ / gcd23) * wider_type(rhs.denominator_ / gcd14)));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator* with checking each intermediate.
+     * @param[in]  rhs: right hand side of operator*
+     * @param[in]  gcd14: gcd of numerator of lhs and denominator of rhs.
+     * @param[in]  gcd23: gcd of numerator of rhs and denominator of lhs.
+     * @param[in]  dummy: compile switcher. in this case, there is no wider type.
+     * @return     result of operator*
+     * @throw      std::overflow_error: when overflow occurs.
+     */
+    constexpr self_type mul(const self_type& rhs, const int_type& gcd14, const int_type& gcd23,
+                            std::false_type dummy) const
+    {
+        using namespace fraction_detail;
+
+        return from_coprime(checked_mul(int_type(numerator_ / gcd14), int_type(rhs.numerator_ / gcd23)),
+                            checked_mul(int_type(denominator_ / gcd23), int_type(rhs.denominator_ / gcd14)));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator/ by rhs, whose numerator is the minimum value, in the wider type.
+     *             the inverse of rhs is not representable, thus
+     *             (n1 * d2) / (d1 * n2) is calculated directly.
+     * @param[in]  rhs: right hand side of operator/
+     * @param[in]  dummy: compile switcher. in this case, there is the wider type.
+     * @return     result of operator/
+     * @throw      std::overflow_error: when overflow occurs.
+     */
+    constexpr self_type div_min(const self_type& rhs, std::true_type dummy) const
+    {
+        return from_wider(wider_type(-(wider_type(numerator_) * wider_type(rhs.denominator_))),
+                          wider_type(-(wider_type(denominator_) * wider_type(rhs.numerator_))));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator/ by rhs, whose numerator is the minimum value, with
+     *             checking each intermediate.
+     * @param[in]  rhs: right hand side of operator/
+     * @param[in]  dummy: compile switcher. in this case, there is no wider type.
+     * @return     result of operator/
+     * @throw      std::overflow_error: when overflow occurs.
+     */
+    constexpr self_type div_min(const self_type& rhs, std::false_type dummy) const
+    {
+        return (numerator_ == 0) ? self_type() :
+               (numerator_ == traits::min()) ? self_type(rhs.denominator_, denominator_) :
+               div_min(rhs, fraction_detail::gcd_negative(numerator_, rhs.numerator_),
+                       fraction_detail::gcd(rhs.denominator_, denominator_));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator/ by rhs, whose numerator is the minimum value, after
+     *             cross reduction. the denominator of the result is
+     *             -(d1 / gcd23) * (n2 / gcd14), which overflows if gcd14 == 1.
+     * @param[in]  rhs: right hand side of operator/
+     * @param[in]  gcd14: gcd of both numerators. numerator of lhs should be != 0 and != min
+     * @param[in]  gcd23: gcd of both denominators.
+     * @return     result of operator/
+     * @throw      std::overflow_error: when overflow occurs.
+     */
+    constexpr self_type div_min(const self_type& rhs, const int_type& gcd14, const int_type& gcd23) const
+    {
+        using namespace fraction_detail;
+
+        return (gcd14 == 1) ? raise_error<self_type>(fraction_errc::overflow) :
+               self_type(pair_type(checked_mul(int_type(-(numerator_ / gcd14)), int_type(rhs.denominator_ / gcd23)),
+                                   checked_mul(int_type(denominator_ / gcd23), int_type(-(rhs.numerator_ / gcd14)))));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      assign numerator/denominator of the wider type, if it fits int_type.
+     * @param[in]  numerator: numerator.
+     * @param[in]  denominator: denominator (> 0).
+     * @return     fraction_errc::ok: assigned.
+     *             fraction_errc::overflow: reduced result does not fit int_type.
+     */
+    template <typename W>
+    fraction_errc assign_wider(const W& numerator, const W& denominator) noexcept
+    {
+        using namespace fraction_detail;
+
+        if (fits<int_type>(numerator) && fits<int_type>(denominator)) {
+            *this = self_type(reduce(pair_type(int_type(numerator), int_type(denominator))));
+            return fraction_errc::ok;
+        }
+        const std::pair<W, W> reduced = reduce(std::pair<W, W>(numerator, denominator));
+        if (not fits<int_type>(reduced.first) || not fits<int_type>(reduced.second)) {
+            return fraction_errc::overflow;
+        }
+        *this = self_type(pair_type(int_type(reduced.first), int_type(reduced.second)));
+        return fraction_errc::ok;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      add n/(denominator of rhs) in the wider type without exceptions.
+     * @param[in]  rhs: right hand side, whose denominator is used.
+     * @param[in]  n: numerator to add. (ex. numerator of rhs for operator+=)
+     * @param[in]  dummy: compile switcher. in this case, there is the wider type.
+     * @return     fraction_errc::ok or fraction_errc::overflow
+     */
+    fraction_errc try_add(const self_type& rhs, const int_type& n, std::true_type dummy) noexcept
+    {
+        const int_type g = fraction_detail::gcd(denominator_, rhs.denominator_);
+        return assign_wider(wider_type(numerator_) * wider_type(rhs.denominator_ / g) +
+                            wider_type(n) * wider_type(denominator_ / g),
+                            wider_type(denominator_ / g) * wider_type(rhs.denominator_));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      add n/(denominator of rhs) with checking each intermediate
+     *             without exceptions.
+     * @param[in]  rhs: right hand side, whose denominator is used.
+     * @param[in]  n: numerator to add. (ex. numerator of rhs for operator+=)
+     * @param[in]  dummy: compile switcher. in this case, there is no wider type.
+     * @return     fraction_errc::ok or fraction_errc::overflow
      */
-    void reduce(void) noexcept;
+    fraction_errc try_add(const self_type& rhs, const int_type& n, std::false_type dummy) noexcept
+    {
+        using namespace fraction_detail;
+
+        const int_type g = gcd(denominator_, rhs.denominator_);
+        const int_type x = rhs.denominator_ / g;
+        const int_type y = denominator_ / g;
+        if (occur_mul(numerator_, x) || occur_mul(n, y) || occur_mul(y, rhs.denominator_) ||
+            occur_add(int_type(numerator_ * x), int_type(n * y))) {
+            return fraction_errc::overflow;
+        }
+        *this = self_type(reduce(pair_type(numerator_ * x + n * y, y * rhs.denominator_)));
+        return fraction_errc::ok;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator-= in the wider type without exceptions.
+     * @param[in]  rhs: right hand side of operator-=
+     * @param[in]  dummy: compile switcher. in this case, there is the wider type.
+     * @return     fraction_errc::ok or fraction_errc::overflow
+     */
+    fraction_errc try_sub(const self_type& rhs, std::true_type dummy) noexcept
+    {
+        const int_type g = fraction_detail::gcd(denominator_, rhs.denominator_);
+        return assign_wider(wider_type(numerator_) * wider_type(rhs.denominator_ / g) -
+                            wider_type(rhs.numerator_) * wider_type(denominator_ / g),
+                            wider_type(denominator_ / g) * wider_type(rhs.denominator_));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator-= with checking each intermediate without exceptions.
+     *             the intermediates are the same as operator-, thus both of
+     *             them overflow for the same operands.
+     * @param[in]  rhs: right hand side of operator-=
+     * @param[in]  dummy: compile switcher. in this case, there is no wider type.
+     * @return     fraction_errc::ok or fraction_errc::overflow
+     */
+    fraction_errc try_sub(const self_type& rhs, std::false_type dummy) noexcept
+    {
+        using namespace fraction_detail;
+
+        const int_type g = gcd(denominator_, rhs.denominator_);
+        const int_type x = rhs.denominator_ / g;
+        const int_type y = denominator_ / g;
+        if (occur_mul(numerator_, x) || occur_mul(rhs.numerator_, y) || occur_mul(y, rhs.denominator_) ||
+            occur_sub(int_type(numerator_ * x), int_type(rhs.numerator_ * y))) {
+            return fraction_errc::overflow;
+        }
+        *this = self_type(reduce(pair_type(numerator_ * x - rhs.numerator_ * y, y * rhs.denominator_)));
+        return fraction_errc::ok;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator*= in the wider type without exceptions.
+     * @param[in]  rhs: right hand side of operator*=
+     * @param[in]  dummy: compile switcher. in this case, there is the wider type.
+     * @return     fraction_errc::ok or fraction_errc::overflow
+     */
+    fraction_errc try_mul(const self_type& rhs, std::true_type dummy) noexcept
+    {
+        using namespace fraction_detail;
+
+        if ((numerator_ == 0) || (rhs.numerator_ == 0)) {
+            *this = self_type();
+            return fraction_errc::ok;
+        }
+        const int_type gcd14 = gcd(numerator_, rhs.denominator_);
+        const int_type gcd23 = gcd(rhs.numerator_, denominator_);
+        const wider_type numerator = wider_type(numerator_ / gcd14) * wider_type(rhs.numerator_ / gcd23);
+        const wider_type denominator = wider_type(denominator_ / gcd23) * wider_type(rhs.denominator_ / gcd14);
+        if (not fits<int_type>(numerator) || not fits<int_type>(denominator)) {
+            return fraction_errc::overflow;
+        }
+        *this = self_type(pair_type(int_type(numerator), int_type(denominator)));
+        return fraction_errc::ok;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator*= with checking each intermediate without exceptions.
+     * @param[in]  rhs: right hand side of operator*=
+     * @param[in]  dummy: compile switcher. in this case, there is no wider type.
+     * @return     fraction_errc::ok or fraction_errc::overflow
+     */
+    fraction_errc try_mul(const self_type& rhs, std::false_type dummy) noexcept
+    {
+        using namespace fraction_detail;
+
+        const int_type gcd14 = gcd(numerator_, rhs.denominator_);
+        const int_type gcd23 = gcd(rhs.numerator_, denominator_);
+        const int_type n1 = numerator_ / gcd14;
+        const int_type n2 = rhs.numerator_ / gcd23;
+        const int_type d1 = denominator_ / gcd23;
+        const int_type d2 = rhs.denominator_ / gcd14;
+        if (occur_mul(n1, n2) || occur_mul(d1, d2)) {
+            return fraction_errc::overflow;
+        }
+        *this = from_coprime(n1 * n2, d1 * d2);
+        return fraction_errc::ok;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator/= by rhs, whose numerator is the minimum value, in
+     *             the wider type without exceptions.
+     * @param[in]  rhs: right hand side of operator/=
+     * @param[in]  dummy: compile switcher. in this case, there is the wider type.
+     * @return     fraction_errc::ok or fraction_errc::overflow
+     */
+    fraction_errc try_div_min(const self_type& rhs, std::true_type dummy) noexcept
+    {
+        return assign_wider(wider_type(-(wider_type(numerator_) * wider_type(rhs.denominator_))),
+                            wider_type(-(wider_type(denominator_) * wider_type(rhs.numerator_))));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator/= by rhs, whose numerator is the minimum value, with
+     *             checking each intermediate without exceptions.
+     * @param[in]  rhs: right hand side of operator/=
+     * @param[in]  dummy: compile switcher. in this case, there is no wider type.
+     * @return     fraction_errc::ok or fraction_errc::overflow
+     */
+    fraction_errc try_div_min(const self_type& rhs, std::false_type dummy) noexcept
+    {
+        using namespace fraction_detail;
+
+        if (numerator_ == 0) {
+            return fraction_errc::ok;
+        }
+        else if (numerator_ == traits::min()) {
+            return try_make(rhs.denominator_, denominator_, *this);
+        }
+        const int_type gcd14 = gcd_negative(numerator_, rhs.numerator_);
+        const int_type gcd23 = gcd(rhs.denominator_, denominator_);
+        if (gcd14 == 1) {
+            // -(numerator of rhs) is required
+            return fraction_errc::overflow;
+        }
+        const int_type n1 = -(numerator_ / gcd14);
+        const int_type n2 = -(rhs.numerator_ / gcd14);
+        const int_type d1 = denominator_ / gcd23;
+        const int_type d2 = rhs.denominator_ / gcd23;
+        if (occur_mul(n1, d2) || occur_mul(d1, n2)) {
+            return fraction_errc::overflow;
+        }
+        *this = self_type(pair_type(n1 * d2, d1 * n2));
+        return fraction_errc::ok;
+    }
     /////////////////////////////////////////////////////////////////////////////
 
 private:
@@ -304,6 +1852,61 @@ private:
 };
 /////////////////////////////////////////////////////////////////////////////
 
+/**
+ * @brief      fraction based on std::intmax_t.
+ */
+using fraction = basic_fraction<std::intmax_t>;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      operator>> for in-stream
+ * @param[in,out] is: in-stream
+ * @param[out] self: derived value from in-stream are set
+ * @return     argument in-stream
+ * @throw      std::runtime_error: new denominator == 0, or
+ *                                 std::abs(minimum value) is required.
+ * @note       the format of fraction is "1/2" when numerator is 1 and
+ *             denominator is 2.
+ */
+template <typename IntT>
+std::istream& operator>>(std::istream& is, basic_fraction<IntT>& self)
+{
+    IntT numerator = 0;
+    char slash = '\0';
+    IntT denominator = 0;
+
+    if (is.good()) {
+        is >> numerator;
+        if (not is.fail() && is.good()) {
+            slash = is.get();
+            if (not is.fail() && (slash == '/') && is.good()) {
+                is >> denominator;
+                if (not is.fail()) {
+                    self.set(numerator, denominator); // todo result check
+                }
+            }
+        }
+    }
+
+    return is;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      operator<< for out-stream
+ * @param[in,out] os: out-stream
+ * @param[in]  self: input for out-stream
+ * @return     argument out-stream
+ * @note       the format of fraction is "1/2" when numerator is 1 and
+ *             denominator is 2.
+ */
+template <typename IntT>
+std::ostream& operator<<(std::ostream& os, const basic_fraction<IntT>& self)
+{
+    return os << self.numerator() << "/" << self.denominator();
+}
+/////////////////////////////////////////////////////////////////////////////
+
 } // namespace ken3 {
 
 #endif // #ifndef INCLUDE_GUARD_KEN3_FRACTION_HPP
@@ -0,0 +1,361 @@
+/**
+ * @file    ken3/fraction/accumulator.hpp
+ * @brief   Implementation of fraction_accumulator class.
+ *          fraction_accumulator sums or multiplies fractions without reduction.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more.
+ * @remark  this module works only with header files.
+ *
+ * @note
+ * Typical usage is;
+ *     ken3::fraction_accumulator acc;
+ *     for (const auto& i: prices) {
+ *         acc += i; // no gcd
+ *     }
+ *     ken3::fraction total = acc.value(); // reduced once
+ *
+ * operators of ken3::fraction reduce each result by gcd. fraction_accumulator
+ * keeps the numerator and the denominator without reduction, and reduces
+ * them only when the next operation makes overflow, on comparison, or on
+ * output. if the operation still makes overflow after the reduction, it is
+ * calculated by the operator of basic_fraction. thus, results and exceptions
+ * are same as basic_fraction. adding a term whose denominator divides the
+ * accumulated one costs a division, a multiplication and an addition, thus
+ * the denominator of terms such as prices (x/100, y/1000) stays small.
+ */
+
+#ifndef INCLUDE_GUARD_KEN3_FRACTION_ACCUMULATOR_HPP
+#define INCLUDE_GUARD_KEN3_FRACTION_ACCUMULATOR_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include "ken3/fraction.hpp"
+
+namespace ken3 {
+
+/**
+ * @class   basic_fraction_accumulator
+ * @brief   accumulator of basic_fraction, which reduces lazily.
+ * @tparam  IntT: integer type of basic_fraction.
+ */
+template <typename IntT>
+class basic_fraction_accumulator
+{
+public:
+    using fraction_type = basic_fraction<IntT>;
+    using int_type = IntT;
+    using pair_type = std::pair<int_type, int_type>;
+private:
+    using self_type = basic_fraction_accumulator<IntT>;
+    using traits = fraction_detail::int_traits<IntT>;
+    /////////////////////////////////////////////////////////////////////////////
+
+public:
+    /**
+     * @brief      default constructor.
+     *             fraction 0/1 is accumulated.
+     */
+    basic_fraction_accumulator(void) noexcept = default;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with initial value.
+     * @param[in]  init: initial value.
+     */
+    basic_fraction_accumulator(const fraction_type& init) noexcept:
+        numerator_(init.numerator()), denominator_(init.denominator())
+    {
+        ;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      copy constructor, move constructor, destructor, copy operator=,
+     *             and move operator= are nothing special.
+     */
+    basic_fraction_accumulator(const self_type& src) noexcept = default;
+    basic_fraction_accumulator(self_type&& src) noexcept = default;
+    ~basic_fraction_accumulator(void) noexcept = default;
+    self_type& operator=(const self_type& rhs) noexcept = default;
+    self_type& operator=(self_type&& rhs) noexcept = default;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator+=
+     * @param[in]  rhs: right hand side of operator+=
+     * @return     result of operator+=
+     * @throw      std::overflow_error: when the reduced result makes overflow.
+     */
+    self_type& operator+=(const fraction_type& rhs)
+    {
+        if (not try_add(rhs.numerator(), rhs.denominator())) {
+            reduce();
+            if (not try_add(rhs.numerator(), rhs.denominator())) {
+                *this = self_type(value() + rhs);
+            }
+        }
+        return *this;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator-=
+     * @param[in]  rhs: right hand side of operator-=
+     * @return     result of operator-=
+     * @throw      std::overflow_error: when the reduced result makes overflow.
+     */
+    self_type& operator-=(const fraction_type& rhs)
+    {
+        if ((rhs.numerator() == traits::min()) || not try_add(-rhs.numerator(), rhs.denominator())) {
+            reduce();
+            if ((rhs.numerator() == traits::min()) || not try_add(-rhs.numerator(), rhs.denominator())) {
+                *this = self_type(value() - rhs);
+            }
+        }
+        return *this;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator*=
+     * @param[in]  rhs: right hand side of operator*=
+     * @return     result of operator*=
+     * @throw      std::overflow_error: when the reduced result makes overflow.
+     */
+    self_type& operator*=(const fraction_type& rhs)
+    {
+        if (not try_mul(rhs.numerator(), rhs.denominator())) {
+            reduce();
+            if (not try_mul(rhs.numerator(), rhs.denominator())) {
+                *this = self_type(value() * rhs);
+            }
+        }
+        return *this;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator/=
+     * @param[in]  rhs: right hand side of operator/=
+     * @return     result of operator/=
+     * @throw      std::overflow_error: when the reduced result makes overflow.
+     *             std::runtime_error: numerator of rhs == 0.
+     */
+    self_type& operator/=(const fraction_type& rhs)
+    {
+        if (rhs.numerator() == 0) {
+            fraction_detail::raise_error(fraction_errc::zero_denominator);
+        }
+        if ((rhs.numerator() == traits::min()) || not try_div(rhs.numerator(), rhs.denominator())) {
+            reduce();
+            if ((rhs.numerator() == traits::min()) || not try_div(rhs.numerator(), rhs.denominator())) {
+                *this = self_type(value() / rhs);
+            }
+        }
+        return *this;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      reduce the accumulated numerator and denominator.
+     */
+    void reduce(void) noexcept
+    {
+        pair_type reduced = fraction_detail::reduce(pair_type(numerator_, denominator_));
+        numerator_ = reduced.first;
+        denominator_ = reduced.second;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get the accumulated value.
+     * @return     reduced fraction
+     */
+    fraction_type value(void) const noexcept
+    {
+        return fraction_type(numerator_, denominator_);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      cast to basic_fraction
+     * @return     reduced fraction
+     */
+    operator fraction_type(void) const noexcept
+    {
+        return value();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator()
+     * @return     std::pair<int_type, int_type> without reduction. The first
+     *             is numerator and second is denominator (> 0).
+     */
+    pair_type operator()(void) const noexcept
+    {
+        return pair_type{numerator_, denominator_};
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator==
+     * @param[in]  rhs: right hand side of operator==
+     * @return     result of operator==
+     */
+    bool operator==(const self_type& rhs) const noexcept
+    {
+        return value() == rhs.value();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator!=
+     * @param[in]  rhs: right hand side of operator!=
+     * @return     result of operator!=
+     */
+    bool operator!=(const self_type& rhs) const noexcept
+    {
+        return not (*this == rhs);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator<
+     * @param[in]  rhs: right hand side of operator<
+     * @return     result of operator<
+     */
+    bool operator<(const self_type& rhs) const noexcept
+    {
+        return value() < rhs.value();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator>
+     * @param[in]  rhs: right hand side of operator>
+     * @return     result of operator>
+     */
+    bool operator>(const self_type& rhs) const noexcept
+    {
+        return (rhs < *this);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator<=
+     * @param[in]  rhs: right hand side of operator<=
+     * @return     result of operator<=
+     */
+    bool operator<=(const self_type& rhs) const noexcept
+    {
+        return not (*this > rhs);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator>=
+     * @param[in]  rhs: right hand side of operator>=
+     * @return     result of operator>=
+     */
+    bool operator>=(const self_type& rhs) const noexcept
+    {
+        return not (*this < rhs);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    /**
+     * @brief      add n/d without reduction, if no overflow occurs.
+     * @param[in]  n: numerator
+     * @param[in]  d: denominator (> 0)
+     * @return     true: added. false: not changed because of overflow.
+     */
+    bool try_add(const int_type& n, const int_type& d) noexcept
+    {
+        using namespace fraction_detail;
+
+        if (denominator_ % d == 0) {
+            const int_type scale = denominator_ / d;
+            if (occur_mul(n, scale) || occur_add(numerator_, int_type(n * scale))) {
+                return false;
+            }
+            numerator_ = numerator_ + n * scale;
+            return true;
+        }
+        if (occur_mul(numerator_, d) || occur_mul(n, denominator_) || occur_mul(denominator_, d) ||
+            occur_add(int_type(numerator_ * d), int_type(n * denominator_))) {
+            return false;
+        }
+        numerator_ = numerator_ * d + n * denominator_;
+        denominator_ = denominator_ * d;
+        return true;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      multiply by n/d without reduction, if no overflow occurs.
+     * @param[in]  n: numerator
+     * @param[in]  d: denominator (> 0)
+     * @return     true: multiplied. false: not changed because of overflow.
+     */
+    bool try_mul(const int_type& n, const int_type& d) noexcept
+    {
+        using namespace fraction_detail;
+
+        if (occur_mul(numerator_, n) || occur_mul(denominator_, d)) {
+            return false;
+        }
+        numerator_ = numerator_ * n;
+        denominator_ = denominator_ * d;
+        return true;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      divide by n/d without reduction, if no overflow occurs.
+     * @param[in]  n: numerator (!= 0, > minimum value)
+     * @param[in]  d: denominator (> 0)
+     * @return     true: divided. false: not changed because of overflow.
+     */
+    bool try_div(const int_type& n, const int_type& d) noexcept
+    {
+        // the denominator is kept positive, thus the sign of n is moved to d
+        return (n < 0) ? try_mul(int_type(-d), int_type(-n)) : try_mul(d, n);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    int_type numerator_ = 0;
+    int_type denominator_ = 1;
+    /////////////////////////////////////////////////////////////////////////////
+
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      accumulator of fraction based on std::intmax_t.
+ */
+using fraction_accumulator = basic_fraction_accumulator<std::intmax_t>;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      operator<< for out-stream. the reduced value is output.
+ * @param[in,out] os: out-stream
+ * @param[in]  self: input for out-stream
+ * @return     argument out-stream
+ */
+template <typename IntT>
+std::ostream& operator<<(std::ostream& os, const basic_fraction_accumulator<IntT>& self)
+{
+    return os << self.value();
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace ken3 {
+
+#endif // #ifndef INCLUDE_GUARD_KEN3_FRACTION_ACCUMULATOR_HPP
@@ -0,0 +1,468 @@
+/**
+ * @file    ken3/fraction/array.hpp
+ * @brief   Implementation of fraction_array class.
+ *          fraction_array keeps fractions as structure of arrays, and
+ *          calculates them in bulk.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more.
+ * @remark  this module works only with header files.
+ *
+ * @note
+ * Typical usage is;
+ *     ken3::fraction_array a{ken3::fraction(1, 2), ken3::fraction(2, 3)};
+ *     ken3::fraction_array::mask_type overflow = a.multiply(ken3::fraction(3, 4));
+ *     std::cout << a[1]; // => "1/2"
+ *
+ * numerators and denominators are kept in two contiguous arrays. batch
+ * operations (multiply, add, subtract) calculate each element in place by
+ * the same reduction as basic_fraction, but never throw. if the result of
+ * an element makes overflow, the element is not changed and the element of
+ * the returned mask is 1, otherwise 0. the loops have neither exception nor
+ * function call, and products are calculated in the wider type as same as
+ * basic_fraction.
+ */
+
+#ifndef INCLUDE_GUARD_KEN3_FRACTION_ARRAY_HPP
+#define INCLUDE_GUARD_KEN3_FRACTION_ARRAY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "ken3/fraction.hpp"
+
+namespace ken3 {
+
+/**
+ * @class   basic_fraction_array
+ * @brief   array of basic_fraction as structure of arrays.
+ * @tparam  IntT: integer type of basic_fraction.
+ */
+template <typename IntT>
+class basic_fraction_array
+{
+public:
+    using fraction_type = basic_fraction<IntT>;
+    using int_type = IntT;
+    using mask_type = std::vector<std::uint8_t>;
+private:
+    using self_type = basic_fraction_array<IntT>;
+    using traits = fraction_detail::int_traits<IntT>;
+    using wider_type = typename traits::wider_type;
+    using has_wider = std::integral_constant<bool, not std::is_void<wider_type>::value>;
+    /////////////////////////////////////////////////////////////////////////////
+
+public:
+    /**
+     * @brief      default constructor.
+     *             empty array is constructed.
+     */
+    basic_fraction_array(void) noexcept = default;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with size. all elements are 0/1.
+     * @param[in]  size: number of elements.
+     */
+    explicit basic_fraction_array(std::size_t size):
+        numerators_(size, 0), denominators_(size, 1)
+    {
+        ;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with fractions.
+     * @param[in]  init: fractions.
+     */
+    basic_fraction_array(std::initializer_list<fraction_type> init):
+        basic_fraction_array(init.begin(), init.end())
+    {
+        ;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with range of fractions.
+     * @param[in]  first: first iterator of range.
+     * @param[in]  last: last iterator of range.
+     */
+    template <typename InputIterator>
+    basic_fraction_array(InputIterator first, InputIterator last)
+    {
+        for ( ; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      copy constructor, move constructor, destructor, copy operator=,
+     *             and move operator= are nothing special.
+     */
+    basic_fraction_array(const self_type& src) = default;
+    basic_fraction_array(self_type&& src) noexcept = default;
+    ~basic_fraction_array(void) noexcept = default;
+    self_type& operator=(const self_type& rhs) = default;
+    self_type& operator=(self_type&& rhs) noexcept = default;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get the number of elements.
+     * @return     number of elements.
+     */
+    std::size_t size(void) const noexcept
+    {
+        return numerators_.size();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      check whether the array is empty or not.
+     * @return     true: empty. false: not empty.
+     */
+    bool empty(void) const noexcept
+    {
+        return numerators_.empty();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      reserve memory for elements.
+     * @param[in]  size: number of elements.
+     */
+    void reserve(std::size_t size)
+    {
+        numerators_.reserve(size);
+        denominators_.reserve(size);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      append a fraction.
+     * @param[in]  f: appended fraction.
+     */
+    void push_back(const fraction_type& f)
+    {
+        numerators_.push_back(f.numerator());
+        denominators_.push_back(f.denominator());
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      get an element.
+     * @param[in]  index: index of the element. should be < size()
+     * @return     fraction
+     */
+    fraction_type operator[](std::size_t index) const
+    {
+        return fraction_type(numerators_[index], denominators_[index]);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      set an element.
+     * @param[in]  index: index of the element. should be < size()
+     * @param[in]  f: new value.
+     */
+    void set(std::size_t index, const fraction_type& f) noexcept
+    {
+        numerators_[index] = f.numerator();
+        denominators_[index] = f.denominator();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      getter of numerators.
+     * @return     pointer to the first numerator.
+     */
+    const int_type* numerators(void) const noexcept
+    {
+        return numerators_.data();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      getter of denominators. all are > 0.
+     * @return     pointer to the first denominator.
+     */
+    const int_type* denominators(void) const noexcept
+    {
+        return denominators_.data();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      multiply each element by k.
+     * @param[in]  k: multiplier.
+     * @return     mask of overflow. 1: the element makes overflow and is not changed.
+     */
+    mask_type multiply(const fraction_type& k)
+    {
+        mask_type overflow(size(), 0);
+        const int_type kn = k.numerator();
+        const int_type kd = k.denominator();
+        // k is usually small, thus gcd is calculated with the remainder by k
+        const bool by_remainder = (kn != 0) && (kn != traits::min());
+        const int_type abs_kn = by_remainder ? fraction_detail::abs(kn) : int_type(1);
+        for (std::size_t i = 0; i < size(); i++) {
+            const int_type g14 = gcd_by_remainder(int_type(numerators_[i] % kd), kd);
+            const int_type g23 = by_remainder ? gcd_by_remainder(int_type(denominators_[i] % abs_kn), abs_kn) :
+                                 fraction_detail::gcd(kn, denominators_[i]);
+            overflow[i] = mul_element(numerators_[i], denominators_[i], kn, kd, g14, g23, has_wider{});
+        }
+        return overflow;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      multiply each element by the element of rhs.
+     * @param[in]  rhs: multipliers. the size should be same.
+     * @return     mask of overflow. 1: the element makes overflow and is not changed.
+     * @throw      std::invalid_argument: sizes are different.
+     */
+    mask_type multiply(const self_type& rhs)
+    {
+        check_size(rhs);
+        mask_type overflow(size(), 0);
+        for (std::size_t i = 0; i < size(); i++) {
+            overflow[i] = mul_element(numerators_[i], denominators_[i], rhs.numerators_[i], rhs.denominators_[i],
+                                      fraction_detail::gcd(numerators_[i], rhs.denominators_[i]),
+                                      fraction_detail::gcd(rhs.numerators_[i], denominators_[i]), has_wider{});
+        }
+        return overflow;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      add k to each element.
+     * @param[in]  k: addend.
+     * @return     mask of overflow. 1: the element makes overflow and is not changed.
+     */
+    mask_type add(const fraction_type& k)
+    {
+        mask_type overflow(size(), 0);
+        const int_type kn = k.numerator();
+        const int_type kd = k.denominator();
+        for (std::size_t i = 0; i < size(); i++) {
+            overflow[i] = add_element(numerators_[i], denominators_[i], kn, kd,
+                                      gcd_by_remainder(int_type(denominators_[i] % kd), kd), false, has_wider{});
+        }
+        return overflow;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      add the element of rhs to each element.
+     * @param[in]  rhs: addends. the size should be same.
+     * @return     mask of overflow. 1: the element makes overflow and is not changed.
+     * @throw      std::invalid_argument: sizes are different.
+     */
+    mask_type add(const self_type& rhs)
+    {
+        check_size(rhs);
+        mask_type overflow(size(), 0);
+        for (std::size_t i = 0; i < size(); i++) {
+            overflow[i] = add_element(numerators_[i], denominators_[i], rhs.numerators_[i], rhs.denominators_[i],
+                                      fraction_detail::gcd(denominators_[i], rhs.denominators_[i]), false, has_wider{});
+        }
+        return overflow;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      subtract the element of rhs from each element.
+     * @param[in]  rhs: subtrahends. the size should be same.
+     * @return     mask of overflow. 1: the element makes overflow and is not changed.
+     * @throw      std::invalid_argument: sizes are different.
+     */
+    mask_type subtract(const self_type& rhs)
+    {
+        check_size(rhs);
+        mask_type overflow(size(), 0);
+        for (std::size_t i = 0; i < size(); i++) {
+            overflow[i] = add_element(numerators_[i], denominators_[i], rhs.numerators_[i], rhs.denominators_[i],
+                                      fraction_detail::gcd(denominators_[i], rhs.denominators_[i]), true, has_wider{});
+        }
+        return overflow;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    /**
+     * @brief      check that sizes are same.
+     * @param[in]  rhs: counter part.
+     * @throw      std::invalid_argument: sizes are different.
+     */
+    void check_size(const self_type& rhs) const
+    {
+        if (size() != rhs.size()) {
+            fraction_detail::raise_error(fraction_errc::invalid_argument, "sizes of fraction_array are different");
+        }
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      store n/d into an element, if both fit int_type.
+     * @param[out] numerator: numerator of the element.
+     * @param[out] denominator: denominator of the element.
+     * @param[in]  reduced: reduced numerator and denominator (> 0).
+     * @return     1: overflow and not stored. 0: stored.
+     */
+    template <typename W>
+    static std::uint8_t store(int_type& numerator, int_type& denominator, const std::pair<W, W>& reduced) noexcept
+    {
+        if (not fraction_detail::fits<int_type>(reduced.first) || not fraction_detail::fits<int_type>(reduced.second)) {
+            return 1;
+        }
+        numerator = int_type(reduced.first);
+        denominator = int_type(reduced.second);
+        return 0;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      calculate gcd of r and y, where r is the remainder of x / y.
+     *             gcd(x, y) == gcd(x % y, y), and it is faster when y is
+     *             much smaller than x.
+     * @param[in]  r: remainder of x / y. |r| < y
+     * @param[in]  y: divisor (> 0)
+     * @return     gcd of x and y.
+     */
+    static int_type gcd_by_remainder(const int_type& r, const int_type& y) noexcept
+    {
+        return (r == 0) ? y : fraction_detail::gcd(r, y);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      multiply n1/d1 by n2/d2 in the wider type. the result of
+     *             cross reduction is already reduced.
+     * @param[in,out] n1: numerator of lhs and result.
+     * @param[in,out] d1: denominator of lhs and result.
+     * @param[in]  n2: numerator of rhs.
+     * @param[in]  d2: denominator of rhs.
+     * @param[in]  g14: gcd of n1 and d2.
+     * @param[in]  g23: gcd of n2 and d1.
+     * @param[in]  dummy: compile switcher. in this case, there is the wider type.
+     * @return     1: overflow. 0: no overflow.
+     */
+    static std::uint8_t mul_element(int_type& n1, int_type& d1, const int_type& n2, const int_type& d2,
+                                    const int_type& g14, const int_type& g23, std::true_type dummy) noexcept
+    {
+        const wider_type n = wider_type(n1 / g14) * wider_type(n2 / g23);
+        const wider_type d = wider_type(d1 / g23) * wider_type(d2 / g14);
+        return store(n1, d1, (n == 0) ? std::pair<wider_type, wider_type>(0, 1) : std::pair<wider_type, wider_type>(n, d));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      multiply n1/d1 by n2/d2 with checking each intermediate.
+     * @param[in,out] n1: numerator of lhs and result.
+     * @param[in,out] d1: denominator of lhs and result.
+     * @param[in]  n2: numerator of rhs.
+     * @param[in]  d2: denominator of rhs.
+     * @param[in]  g14: gcd of n1 and d2.
+     * @param[in]  g23: gcd of n2 and d1.
+     * @param[in]  dummy: compile switcher. in this case, there is no wider type.
+     * @return     1: overflow. 0: no overflow.
+     */
+    static std::uint8_t mul_element(int_type& n1, int_type& d1, const int_type& n2, const int_type& d2,
+                                    const int_type& g14, const int_type& g23, std::false_type dummy) noexcept
+    {
+        using namespace fraction_detail;
+
+        const int_type a = n1 / g14;
+        const int_type b = n2 / g23;
+        const int_type c = d1 / g23;
+        const int_type d = d2 / g14;
+        if (occur_mul(a, b) || occur_mul(c, d)) {
+            return 1;
+        }
+        n1 = a * b;
+        d1 = (n1 == 0) ? int_type(1) : int_type(c * d);
+        return 0;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      add n2/d2 to n1/d1 in the wider type.
+     *             both are reduced, thus t = n1 * (d2 / g) + n2 * (d1 / g) and
+     *             (d1 / g) * d2 have no common factor except for one of t and g.
+     *             it is reduced by gcd(t % g, g) instead of gcd of 128 bits.
+     * @param[in,out] n1: numerator of lhs and result.
+     * @param[in,out] d1: denominator of lhs and result.
+     * @param[in]  n2: numerator of rhs.
+     * @param[in]  d2: denominator of rhs.
+     * @param[in]  g: gcd of d1 and d2.
+     * @param[in]  subtract: true: n1/d1 - n2/d2 is calculated instead.
+     * @param[in]  dummy: compile switcher. in this case, there is the wider type.
+     * @return     1: overflow. 0: no overflow.
+     */
+    static std::uint8_t add_element(int_type& n1, int_type& d1, const int_type& n2, const int_type& d2,
+                                    const int_type& g, bool subtract, std::true_type dummy) noexcept
+    {
+        const wider_type t = subtract ? (wider_type(n1) * wider_type(d2 / g) - wider_type(n2) * wider_type(d1 / g)) :
+                                        (wider_type(n1) * wider_type(d2 / g) + wider_type(n2) * wider_type(d1 / g));
+        const wider_type d = wider_type(d1 / g) * wider_type(d2);
+        const wider_type common = (g == 1) ? wider_type(1) : wider_type(gcd_by_remainder(int_type(t % wider_type(g)), g));
+        return store(n1, d1, (t == 0) ? std::pair<wider_type, wider_type>(0, 1) :
+                             std::pair<wider_type, wider_type>(t / common, d / common));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      add n2/d2 to n1/d1 with checking each intermediate.
+     *             it is reduced by gcd(t % g, g) as same as the wider type.
+     * @param[in,out] n1: numerator of lhs and result.
+     * @param[in,out] d1: denominator of lhs and result.
+     * @param[in]  n2: numerator of rhs.
+     * @param[in]  d2: denominator of rhs.
+     * @param[in]  g: gcd of d1 and d2.
+     * @param[in]  subtract: true: n1/d1 - n2/d2 is calculated instead.
+     * @param[in]  dummy: compile switcher. in this case, there is no wider type.
+     * @return     1: overflow. 0: no overflow.
+     */
+    static std::uint8_t add_element(int_type& n1, int_type& d1, const int_type& n2, const int_type& d2,
+                                    const int_type& g, bool subtract, std::false_type dummy) noexcept
+    {
+        using namespace fraction_detail;
+
+        const int_type s1 = d2 / g;
+        const int_type s2 = d1 / g;
+        if (occur_mul(n1, s1) || occur_mul(n2, s2) || occur_mul(s2, d2)) {
+            return 1;
+        }
+        if (subtract ? occur_sub(int_type(n1 * s1), int_type(n2 * s2)) : occur_add(int_type(n1 * s1), int_type(n2 * s2))) {
+            return 1;
+        }
+        const int_type t = subtract ? int_type(n1 * s1 - n2 * s2) : int_type(n1 * s1 + n2 * s2);
+        const int_type common = (g == 1) ? int_type(1) : gcd_by_remainder(int_type(t % g), g);
+        n1 = (t == 0) ? int_type(0) : int_type(t / common);
+        d1 = (t == 0) ? int_type(1) : int_type(s2 * d2 / common);
+        return 0;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    std::vector<int_type> numerators_;
+    std::vector<int_type> denominators_;
+    /////////////////////////////////////////////////////////////////////////////
+
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      array of fraction based on std::intmax_t.
+ */
+using fraction_array = basic_fraction_array<std::intmax_t>;
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace ken3 {
+
+#endif // #ifndef INCLUDE_GUARD_KEN3_FRACTION_ARRAY_HPP
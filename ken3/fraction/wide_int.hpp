@@ -0,0 +1,697 @@
+/**
+ * @file    ken3/fraction/wide_int.hpp
+ * @brief   Implementation of wide_int class.
+ *          wide_int is a fixed width signed integer for ken3::basic_fraction.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more.
+ * @remark  this module works only with header files.
+ *
+ * @note
+ * Typical usage is;
+ *     ken3::basic_fraction<ken3::wide_int<256>> f(1, 3);
+ *     std::cout << f * f; // => "1/9"
+ *
+ * wide_int<Bits> is two's complement in Bits / 64 words of 64 bits, and
+ * behaves as built-in signed integers; division truncates toward zero,
+ * operator>> is arithmetic shift, and overflow wraps around. Bits shall be
+ * a multiple of 64 and >= 128. wide_int is implicitly constructed from
+ * std::intmax_t and narrower wide_int, and explicitly casted to
+ * std::intmax_t, floating point types and narrower wide_int.
+ * basic_fraction<wide_int<N>> uses wide_int<2N> for intermediates.
+ * wide_int is not constexpr, and is kept on the stack without heap.
+ */
+
+#ifndef INCLUDE_GUARD_KEN3_FRACTION_WIDE_INT_HPP
+#define INCLUDE_GUARD_KEN3_FRACTION_WIDE_INT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "ken3/fraction.hpp"
+
+namespace ken3 {
+
+/**
+ * @class   wide_int
+ * @brief   fixed width signed integer of Bits bits.
+ * @tparam  Bits: bit width. a multiple of 64 and >= 128.
+ */
+template <std::size_t Bits>
+class wide_int
+{
+    static_assert((Bits % 64 == 0) && (Bits >= 128), "Bits shall be a multiple of 64 and >= 128");
+    template <std::size_t> friend class wide_int;
+
+public:
+    static constexpr std::size_t size = Bits / 64;
+private:
+    using self_type = wide_int<Bits>;
+    using word_type = std::uint64_t;
+    /////////////////////////////////////////////////////////////////////////////
+
+public:
+    /**
+     * @brief      default constructor.
+     *             0 is constructed.
+     */
+    wide_int(void) noexcept: wide_int(0)
+    {
+        ;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with built-in integer.
+     * @param[in]  x: value
+     */
+    wide_int(std::intmax_t x) noexcept
+    {
+        words_[0] = static_cast<word_type>(x);
+        for (std::size_t i = 1; i < size; i++) {
+            words_[i] = (x < 0) ? ~word_type(0) : word_type(0);
+        }
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with narrower wide_int. the sign is extended.
+     * @param[in]  src: value
+     */
+    template <std::size_t B, typename std::enable_if<(B < Bits), std::nullptr_t>::type = nullptr>
+    wide_int(const wide_int<B>& src) noexcept
+    {
+        for (std::size_t i = 0; i < size; i++) {
+            words_[i] = (i < src.size) ? src.words_[i] :
+                        src.negative() ? ~word_type(0) : word_type(0);
+        }
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with wider wide_int. upper bits are truncated.
+     * @param[in]  src: value
+     */
+    template <std::size_t B, typename std::enable_if<(B > Bits), std::nullptr_t>::type = nullptr>
+    explicit wide_int(const wide_int<B>& src) noexcept
+    {
+        for (std::size_t i = 0; i < size; i++) {
+            words_[i] = src.words_[i];
+        }
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      copy constructor, move constructor, destructor, copy operator=,
+     *             and move operator= are nothing special.
+     */
+    wide_int(const self_type& src) noexcept = default;
+    wide_int(self_type&& src) noexcept = default;
+    ~wide_int(void) noexcept = default;
+    self_type& operator=(const self_type& rhs) noexcept = default;
+    self_type& operator=(self_type&& rhs) noexcept = default;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      minimum value.
+     * @return     -2^(Bits - 1)
+     */
+    static self_type min(void) noexcept
+    {
+        self_type result;
+        result.words_[size - 1] = word_type(1) << 63;
+        return result;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      maximum value.
+     * @return     2^(Bits - 1) - 1
+     */
+    static self_type max(void) noexcept
+    {
+        return ~min();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      check the sign.
+     * @return     true: < 0. false: >= 0
+     */
+    bool negative(void) const noexcept
+    {
+        return (words_[size - 1] >> 63) != 0;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      count trailing zero bits.
+     * @return     number of trailing zero bits. Bits for 0.
+     */
+    int count_trailing_zeros(void) const noexcept
+    {
+        for (std::size_t i = 0; i < size; i++) {
+            if (words_[i] != 0) {
+                return static_cast<int>(i * 64) + count_trailing_zeros(words_[i]);
+            }
+        }
+        return static_cast<int>(Bits);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      unary operator-
+     * @return     negated value. min() is not changed.
+     */
+    self_type operator-(void) const noexcept
+    {
+        self_type result = ~(*this);
+        result += 1;
+        return result;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator~
+     * @return     value whose bits are inverted.
+     */
+    self_type operator~(void) const noexcept
+    {
+        self_type result;
+        for (std::size_t i = 0; i < size; i++) {
+            result.words_[i] = ~words_[i];
+        }
+        return result;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator+=
+     * @param[in]  rhs: right hand side of operator+=
+     * @return     result of operator+=
+     */
+    self_type& operator+=(const self_type& rhs) noexcept
+    {
+        word_type carry = 0;
+        for (std::size_t i = 0; i < size; i++) {
+            word_type sum = words_[i] + rhs.words_[i];
+            word_type next = (sum < words_[i]) ? 1 : 0;
+            words_[i] = sum + carry;
+            carry = next + ((words_[i] < sum) ? 1 : 0);
+        }
+        return *this;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator-=
+     * @param[in]  rhs: right hand side of operator-=
+     * @return     result of operator-=
+     */
+    self_type& operator-=(const self_type& rhs) noexcept
+    {
+        word_type borrow = 0;
+        for (std::size_t i = 0; i < size; i++) {
+            word_type diff = words_[i] - rhs.words_[i];
+            word_type next = (words_[i] < rhs.words_[i]) ? 1 : 0;
+            words_[i] = diff - borrow;
+            borrow = next + ((diff < borrow) ? 1 : 0);
+        }
+        return *this;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator*=
+     *             the lower Bits bits of the product of two's complement are
+     *             same as the signed product, thus signs are not cared.
+     * @param[in]  rhs: right hand side of operator*=
+     * @return     result of operator*=
+     */
+    self_type& operator*=(const self_type& rhs) noexcept
+    {
+        self_type result;
+        for (std::size_t i = 0; i < size; i++) {
+            if (words_[i] == 0) {
+                continue;
+            }
+            word_type carry = 0;
+            for (std::size_t j = 0; (i + j) < size; j++) {
+                word_type high = 0;
+                word_type low = multiply(words_[i], rhs.words_[j], high);
+                word_type sum = result.words_[i + j] + low;
+                high += (sum < low) ? 1 : 0;
+                result.words_[i + j] = sum + carry;
+                high += (result.words_[i + j] < sum) ? 1 : 0;
+                carry = high;
+            }
+        }
+        *this = result;
+        return *this;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator/=
+     * @param[in]  rhs: right hand side of operator/=. should not be 0
+     * @return     result of operator/=, which is truncated toward zero.
+     */
+    self_type& operator/=(const self_type& rhs) noexcept
+    {
+        self_type remainder;
+        divide(*this, rhs, *this, remainder);
+        return *this;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator%=
+     * @param[in]  rhs: right hand side of operator%=. should not be 0
+     * @return     result of operator%=, whose sign is same as lhs.
+     */
+    self_type& operator%=(const self_type& rhs) noexcept
+    {
+        self_type quotient;
+        divide(*this, rhs, quotient, *this);
+        return *this;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator<<=
+     * @param[in]  shift: shift width (>= 0)
+     * @return     result of operator<<=
+     */
+    self_type& operator<<=(int shift) noexcept
+    {
+        const std::size_t words = static_cast<std::size_t>(shift) / 64;
+        const int bits = shift % 64;
+        for (std::size_t i = size; i-- > 0; ) {
+            word_type upper = (i >= words) ? words_[i - words] : 0;
+            word_type lower = (i >= words + 1) ? words_[i - words - 1] : 0;
+            words_[i] = (bits == 0) ? upper : ((upper << bits) | (lower >> (64 - bits)));
+        }
+        return *this;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator>>=. it is arithmetic shift.
+     * @param[in]  shift: shift width (>= 0)
+     * @return     result of operator>>=
+     */
+    self_type& operator>>=(int shift) noexcept
+    {
+        const word_type fill = negative() ? ~word_type(0) : word_type(0);
+        const std::size_t words = static_cast<std::size_t>(shift) / 64;
+        const int bits = shift % 64;
+        for (std::size_t i = 0; i < size; i++) {
+            word_type lower = (i + words < size) ? words_[i + words] : fill;
+            word_type upper = (i + words + 1 < size) ? words_[i + words + 1] : fill;
+            words_[i] = (bits == 0) ? lower : ((lower >> bits) | (upper << (64 - bits)));
+        }
+        return *this;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator&=
+     * @param[in]  rhs: right hand side of operator&=
+     * @return     result of operator&=
+     */
+    self_type& operator&=(const self_type& rhs) noexcept
+    {
+        for (std::size_t i = 0; i < size; i++) {
+            words_[i] &= rhs.words_[i];
+        }
+        return *this;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator|=
+     * @param[in]  rhs: right hand side of operator|=
+     * @return     result of operator|=
+     */
+    self_type& operator|=(const self_type& rhs) noexcept
+    {
+        for (std::size_t i = 0; i < size; i++) {
+            words_[i] |= rhs.words_[i];
+        }
+        return *this;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      binary operators. they are same as compound operators.
+     * @param[in]  lhs: left hand side
+     * @param[in]  rhs: right hand side
+     * @return     result
+     */
+    friend self_type operator+(self_type lhs, const self_type& rhs) noexcept { return lhs += rhs; }
+    friend self_type operator-(self_type lhs, const self_type& rhs) noexcept { return lhs -= rhs; }
+    friend self_type operator*(self_type lhs, const self_type& rhs) noexcept { return lhs *= rhs; }
+    friend self_type operator/(self_type lhs, const self_type& rhs) noexcept { return lhs /= rhs; }
+    friend self_type operator%(self_type lhs, const self_type& rhs) noexcept { return lhs %= rhs; }
+    friend self_type operator&(self_type lhs, const self_type& rhs) noexcept { return lhs &= rhs; }
+    friend self_type operator|(self_type lhs, const self_type& rhs) noexcept { return lhs |= rhs; }
+    friend self_type operator<<(self_type lhs, int shift) noexcept { return lhs <<= shift; }
+    friend self_type operator>>(self_type lhs, int shift) noexcept { return lhs >>= shift; }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator==
+     * @param[in]  lhs: left hand side of operator==
+     * @param[in]  rhs: right hand side of operator==
+     * @return     result of operator==
+     */
+    friend bool operator==(const self_type& lhs, const self_type& rhs) noexcept
+    {
+        for (std::size_t i = 0; i < size; i++) {
+            if (lhs.words_[i] != rhs.words_[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator<. the sign is compared at first.
+     * @param[in]  lhs: left hand side of operator<
+     * @param[in]  rhs: right hand side of operator<
+     * @return     result of operator<
+     */
+    friend bool operator<(const self_type& lhs, const self_type& rhs) noexcept
+    {
+        return (lhs.negative() != rhs.negative()) ? lhs.negative() : less_unsigned(lhs, rhs);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      other comparison operators. they are based on operator== and operator<.
+     * @param[in]  lhs: left hand side
+     * @param[in]  rhs: right hand side
+     * @return     result
+     */
+    friend bool operator!=(const self_type& lhs, const self_type& rhs) noexcept { return not (lhs == rhs); }
+    friend bool operator>(const self_type& lhs, const self_type& rhs) noexcept { return (rhs < lhs); }
+    friend bool operator<=(const self_type& lhs, const self_type& rhs) noexcept { return not (rhs < lhs); }
+    friend bool operator>=(const self_type& lhs, const self_type& rhs) noexcept { return not (lhs < rhs); }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      cast to std::intmax_t. upper bits are truncated.
+     * @return     casted std::intmax_t
+     */
+    explicit operator std::intmax_t(void) const noexcept
+    {
+        return static_cast<std::intmax_t>(words_[0]);
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      cast to long double
+     * @return     casted long double
+     */
+    explicit operator long double(void) const noexcept
+    {
+        const self_type magnitude = negative() ? -(*this) : *this;
+        long double result = 0.0L;
+        for (std::size_t i = size; i-- > 0; ) {
+            result = result * 18446744073709551616.0L + static_cast<long double>(magnitude.words_[i]);
+        }
+        return negative() ? -result : result;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      cast to double
+     * @return     casted double
+     */
+    explicit operator double(void) const noexcept
+    {
+        return static_cast<double>(static_cast<long double>(*this));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      cast to float
+     * @return     casted float
+     */
+    explicit operator float(void) const noexcept
+    {
+        return static_cast<float>(static_cast<long double>(*this));
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator<< for out-stream. the format is decimal.
+     * @param[in,out] os: out-stream
+     * @param[in]  self: input for out-stream
+     * @return     argument out-stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const self_type& self)
+    {
+        // divided by 10^9 repeatedly, and printed from the upper chunk
+        const word_type chunk = 1000000000;
+        self_type magnitude = self.negative() ? -self : self;
+        std::vector<word_type> chunks;
+        do {
+            self_type remainder;
+            divide_unsigned(magnitude, self_type(static_cast<std::intmax_t>(chunk)), magnitude, remainder);
+            chunks.push_back(remainder.words_[0]);
+        } while (magnitude != 0);
+
+        std::ostringstream oss;
+        oss << (self.negative() ? "-" : "") << chunks.back();
+        for (std::size_t i = chunks.size() - 1; i-- > 0; ) {
+            oss << std::setw(9) << std::setfill('0') << chunks[i];
+        }
+        return os << oss.str();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    /**
+     * @brief      count trailing zero bits of a word.
+     * @param[in]  x: word. should be != 0
+     * @return     number of trailing zero bits.
+     */
+    static int count_trailing_zeros(word_type x) noexcept
+    {
+#if defined(__GNUC__)
+        return __builtin_ctzll(x);
+#else
+        int result = 0;
+        for ( ; (x & 1) == 0; x >>= 1) {
+            result++;
+        }
+        return result;
+#endif
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      multiply two words.
+     * @param[in]  x: lhs
+     * @param[in]  y: rhs
+     * @param[out] high: upper word of the product.
+     * @return     lower word of the product.
+     */
+    static word_type multiply(word_type x, word_type y, word_type& high) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 product = static_cast<unsigned __int128>(x) * y;
+        high = static_cast<word_type>(product >> 64);
+        return static_cast<word_type>(product);
+#else
+        const word_type mask = 0xFFFFFFFFULL;
+        word_type ll = (x & mask) * (y & mask);
+        word_type lh = (x & mask) * (y >> 32);
+        word_type hl = (x >> 32) * (y & mask);
+        word_type hh = (x >> 32) * (y >> 32);
+        word_type middle = (ll >> 32) + (lh & mask) + (hl & mask);
+        high = hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+        return (middle << 32) | (ll & mask);
+#endif
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      compare as unsigned integers.
+     * @param[in]  lhs: left hand side
+     * @param[in]  rhs: right hand side
+     * @return     true: lhs < rhs. false: otherwise.
+     */
+    static bool less_unsigned(const self_type& lhs, const self_type& rhs) noexcept
+    {
+        for (std::size_t i = size; i-- > 0; ) {
+            if (lhs.words_[i] != rhs.words_[i]) {
+                return (lhs.words_[i] < rhs.words_[i]);
+            }
+        }
+        return false;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      divide as unsigned integers.
+     *             a divisor < 2^32 is divided by each 32 bits (short division),
+     *             the others are divided by each bit (long division).
+     * @param[in]  x: dividend
+     * @param[in]  y: divisor. should not be 0
+     * @param[out] quotient: quotient. it may be same as x.
+     * @param[out] remainder: remainder. it may be same as x.
+     */
+    static void divide_unsigned(const self_type& x, const self_type& y, self_type& quotient, self_type& remainder) noexcept
+    {
+        bool is_short = (y.words_[0] >> 32) == 0;
+        for (std::size_t i = 1; i < size; i++) {
+            is_short = is_short && (y.words_[i] == 0);
+        }
+
+        self_type q;
+        self_type r;
+        if (is_short) {
+            word_type rest = 0;
+            for (std::size_t i = size * 2; i-- > 0; ) {
+                word_type current = (rest << 32) | ((x.words_[i / 2] >> ((i % 2) * 32)) & 0xFFFFFFFFULL);
+                q.words_[i / 2] |= (current / y.words_[0]) << ((i % 2) * 32);
+                rest = current % y.words_[0];
+            }
+            r.words_[0] = rest;
+        }
+        else {
+            for (std::size_t i = Bits; i-- > 0; ) {
+                r <<= 1;
+                r.words_[0] |= (x.words_[i / 64] >> (i % 64)) & 1;
+                if (not less_unsigned(r, y)) {
+                    r -= y;
+                    q.words_[i / 64] |= word_type(1) << (i % 64);
+                }
+            }
+        }
+        quotient = q;
+        remainder = r;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      divide as signed integers, as same as built-in integers.
+     * @param[in]  x: dividend
+     * @param[in]  y: divisor. should not be 0
+     * @param[out] quotient: quotient truncated toward zero. it may be same as x.
+     * @param[out] remainder: remainder whose sign is same as x. it may be same as x.
+     */
+    static void divide(const self_type& x, const self_type& y, self_type& quotient, self_type& remainder) noexcept
+    {
+        // min() is negated to itself, which is 2^(Bits - 1) as unsigned.
+        const bool x_negative = x.negative();
+        const bool y_negative = y.negative();
+        divide_unsigned(x_negative ? -x : x, y_negative ? -y : y, quotient, remainder);
+        if (x_negative != y_negative) {
+            quotient = -quotient;
+        }
+        if (x_negative) {
+            remainder = -remainder;
+        }
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    word_type words_[size];
+    /////////////////////////////////////////////////////////////////////////////
+
+};
+/////////////////////////////////////////////////////////////////////////////
+
+template <std::size_t Bits>
+constexpr std::size_t wide_int<Bits>::size;
+
+namespace fraction_detail {
+
+/**
+ * @struct  int_traits
+ * @brief   int_traits for wide_int. wide_int<2 * Bits> is used for intermediates.
+ */
+template <std::size_t Bits>
+struct int_traits<wide_int<Bits>, void>
+{
+    using wider_type = wide_int<Bits * 2>;
+
+    static wide_int<Bits> min(void) noexcept
+    {
+        return wide_int<Bits>::min();
+    }
+
+    static wide_int<Bits> max(void) noexcept
+    {
+        return wide_int<Bits>::max();
+    }
+
+    static int count_trailing_zeros(const wide_int<Bits>& x) noexcept
+    {
+        return x.count_trailing_zeros();
+    }
+};
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace fraction_detail {
+} // namespace ken3 {
+
+namespace std {
+
+/**
+ * @class   numeric_limits
+ * @brief   numeric_limits for ken3::wide_int.
+ */
+template <std::size_t Bits>
+class numeric_limits<ken3::wide_int<Bits>>
+{
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = true;
+    static constexpr bool is_exact = true;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = false;
+    static constexpr int digits = static_cast<int>(Bits) - 1;
+    static constexpr int radix = 2;
+
+    static ken3::wide_int<Bits> min(void) noexcept
+    {
+        return ken3::wide_int<Bits>::min();
+    }
+
+    static ken3::wide_int<Bits> lowest(void) noexcept
+    {
+        return ken3::wide_int<Bits>::min();
+    }
+
+    static ken3::wide_int<Bits> max(void) noexcept
+    {
+        return ken3::wide_int<Bits>::max();
+    }
+};
+/////////////////////////////////////////////////////////////////////////////
+
+template <std::size_t Bits> constexpr bool numeric_limits<ken3::wide_int<Bits>>::is_specialized;
+template <std::size_t Bits> constexpr bool numeric_limits<ken3::wide_int<Bits>>::is_signed;
+template <std::size_t Bits> constexpr bool numeric_limits<ken3::wide_int<Bits>>::is_integer;
+template <std::size_t Bits> constexpr bool numeric_limits<ken3::wide_int<Bits>>::is_exact;
+template <std::size_t Bits> constexpr bool numeric_limits<ken3::wide_int<Bits>>::is_bounded;
+template <std::size_t Bits> constexpr bool numeric_limits<ken3::wide_int<Bits>>::is_modulo;
+template <std::size_t Bits> constexpr int numeric_limits<ken3::wide_int<Bits>>::digits;
+template <std::size_t Bits> constexpr int numeric_limits<ken3::wide_int<Bits>>::radix;
+
+} // namespace std {
+
+#endif // #ifndef INCLUDE_GUARD_KEN3_FRACTION_WIDE_INT_HPP
@@ -4,7 +4,13 @@
  *          Five functions (occur_add(), occur_sub(), occur_mul(), occur_div(),
  *          occur_abs()) are defined. All those informs overflow condition by
  *          return value, true means overflow occurs.
+ *          All those are constexpr, thus usable in constant expressions.
  *          Dividing by zero is out of scope of occur_div().
+ *          Three functions (checked_add(), checked_sub(), checked_mul())
+ *          calculate the result and inform overflow condition at once.
+ *          saturating_*() clamp the result to the limits of the type, and
+ *          wrapping_*() wrap it around like two's complement. Both have
+ *          batch versions for arrays.
  * @author  toda
  * @date    2019-12-17
  * @version 0.1.0
@@ -32,13 +38,40 @@
  *     unsigned char x = 1, y = 0;
  *     // not take care of dividing by zero 
  *     std::cout << ken3::overflow::occur_div(x, y); // => false
+ *
+ *     int price = 1000, quantity = 3, total = 0;
+ *     if (not ken3::overflow::checked_mul(price, quantity, total)) {
+ *         std::cout << total; // => 3000
+ *     }
+ *
+ * occur_add(), occur_sub() and occur_mul() use __builtin_*_overflow_p() of
+ * GCC 7 or later, which does not divide. checked_add(), checked_sub() and
+ * checked_mul() use __builtin_*_overflow() of GCC 5 or later and clang.
+ * Other compilers use the portable code, which checks by comparisons and
+ * divisions in advance.
+ *
+ *     short a = 30000, b = 10000;
+ *     std::cout << ken3::overflow::saturating_add(a, b); // => 32767
+ *     std::cout << ken3::overflow::wrapping_add(a, b); // => -25536
+ *
+ *     std::vector<std::int16_t> x(n), y(n), z(n);
+ *     ken3::overflow::saturating_add(x.data(), y.data(), z.data(), n);
+ *
+ * batch saturating_add() and saturating_sub() of 8 and 16 bits integers
+ * use SSE2 (paddsw, paddusb, etc.) if available. the other batch functions
+ * are simple loops, which compilers can vectorize.
  */
 
 #ifndef INCLUDE_GUARD_KEN3_OVERFLOW_HPP
 #define INCLUDE_GUARD_KEN3_OVERFLOW_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <type_traits>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 namespace ken3 {
 namespace overflow {
@@ -53,7 +86,7 @@ namespace overflow_detail {
  * @return     true: overflow occurs by (x + y). false: no overflow
  */
 template <typename T>
-bool occur_add(T x, T y, typename std::enable_if<std::is_signed<T>::value>::type * =nullptr) noexcept
+constexpr bool occur_add(T x, T y, typename std::enable_if<std::is_signed<T>::value>::type * =nullptr) noexcept
 {
     using limit = std::numeric_limits<T>;
 
@@ -72,7 +105,7 @@ bool occur_add(T x, T y, typename std::enable_if<std::is_signed<T>::value>::type
  * @return     true: overflow occurs by (x + y). false: no overflow
  */
 template <typename T>
-bool occur_add(T x, T y, typename std::enable_if<std::is_unsigned<T>::value>::type * =nullptr) noexcept
+constexpr bool occur_add(T x, T y, typename std::enable_if<std::is_unsigned<T>::value>::type * =nullptr) noexcept
 {
     using limit = std::numeric_limits<T>;
 
@@ -88,7 +121,7 @@ bool occur_add(T x, T y, typename std::enable_if<std::is_unsigned<T>::value>::ty
  * @return     true: overflow occurs by (x - y). false: no overflow
  */
 template <typename T>
-bool occur_sub(T x, T y, typename std::enable_if<std::is_signed<T>::value>::type * =nullptr) noexcept
+constexpr bool occur_sub(T x, T y, typename std::enable_if<std::is_signed<T>::value>::type * =nullptr) noexcept
 {
     using limit = std::numeric_limits<T>;
 
@@ -107,7 +140,7 @@ bool occur_sub(T x, T y, typename std::enable_if<std::is_signed<T>::value>::type
  * @return     true: overflow occurs by (x - y). false: no overflow
  */
 template <typename T>
-bool occur_sub(T x, T y, typename std::enable_if<std::is_unsigned<T>::value>::type * =nullptr) noexcept
+constexpr bool occur_sub(T x, T y, typename std::enable_if<std::is_unsigned<T>::value>::type * =nullptr) noexcept
 {
     using limit = std::numeric_limits<T>;
 
@@ -123,7 +156,7 @@ bool occur_sub(T x, T y, typename std::enable_if<std::is_unsigned<T>::value>::ty
  * @return     true: overflow occurs by (x * y). false: no overflow
  */
 template <typename T>
-bool occur_mul(T x, T y, typename std::enable_if<std::is_signed<T>::value>::type * =nullptr) noexcept
+constexpr bool occur_mul(T x, T y, typename std::enable_if<std::is_signed<T>::value>::type * =nullptr) noexcept
 {
     using limit = std::numeric_limits<T>;
 
@@ -143,7 +176,7 @@ bool occur_mul(T x, T y, typename std::enable_if<std::is_signed<T>::value>::type
  * @return     true: overflow occurs by (x * y). false: no overflow
  */
 template <typename T>
-bool occur_mul(T x, T y, typename std::enable_if<std::is_unsigned<T>::value>::type * =nullptr) noexcept
+constexpr bool occur_mul(T x, T y, typename std::enable_if<std::is_unsigned<T>::value>::type * =nullptr) noexcept
 {
     using limit = std::numeric_limits<T>;
 
@@ -160,7 +193,7 @@ bool occur_mul(T x, T y, typename std::enable_if<std::is_unsigned<T>::value>::ty
  * @note       dividing by zero is out of scope of this function (retuen false).
  */
 template <typename T>
-bool occur_div(T x, T y, typename std::enable_if<std::is_signed<T>::value>::type * =nullptr) noexcept
+constexpr bool occur_div(T x, T y, typename std::enable_if<std::is_signed<T>::value>::type * =nullptr) noexcept
 {
     using limit = std::numeric_limits<T>;
 
@@ -177,7 +210,7 @@ bool occur_div(T x, T y, typename std::enable_if<std::is_signed<T>::value>::type
  * @note       dividing by zero is out of scope of this function (retuen false).
  */
 template <typename T>
-bool occur_div(T x, T y, typename std::enable_if<std::is_unsigned<T>::value>::type * =nullptr) noexcept
+constexpr bool occur_div(T x, T y, typename std::enable_if<std::is_unsigned<T>::value>::type * =nullptr) noexcept
 {
     return false;
 }
@@ -190,7 +223,7 @@ bool occur_div(T x, T y, typename std::enable_if<std::is_unsigned<T>::value>::ty
  * @return     true: overflow occurs by abs(x). false: no overflow
  */
 template <typename T>
-bool occur_abs(T x, typename std::enable_if<std::is_signed<T>::value>::type * =nullptr) noexcept
+constexpr bool occur_abs(T x, typename std::enable_if<std::is_signed<T>::value>::type * =nullptr) noexcept
 {
     using limit = std::numeric_limits<T>;
 
@@ -205,12 +238,62 @@ bool occur_abs(T x, typename std::enable_if<std::is_signed<T>::value>::type * =n
  * @return     true: overflow occurs by abs(x). false: no overflow
  */
 template <typename T>
-bool occur_abs(T x, typename std::enable_if<std::is_unsigned<T>::value>::type * =nullptr) noexcept
+constexpr bool occur_abs(T x, typename std::enable_if<std::is_unsigned<T>::value>::type * =nullptr) noexcept
 {
     return false;
 }
 /////////////////////////////////////////////////////////////////////////////
 
+/**
+ * @brief      unsigned type for wrapping arithmetic of T.
+ *             it is not narrower than unsigned int, thus no promotion to int.
+ */
+template <typename T>
+using wrap_type = typename std::make_unsigned<typename std::common_type<T, unsigned int>::type>::type;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate (x + y) with wrapping around like two's complement.
+ * @param[in]  x: lhs of (x + y)
+ * @param[in]  y: rhs of (x + y)
+ * @tparam     T: integer type
+ * @return     the lower bits of (x + y)
+ */
+template <typename T>
+constexpr T wrap_add(T x, T y) noexcept
+{
+    return static_cast<T>(static_cast<wrap_type<T>>(x) + static_cast<wrap_type<T>>(y));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate (x - y) with wrapping around like two's complement.
+ * @param[in]  x: lhs of (x - y)
+ * @param[in]  y: rhs of (x - y)
+ * @tparam     T: integer type
+ * @return     the lower bits of (x - y)
+ */
+template <typename T>
+constexpr T wrap_sub(T x, T y) noexcept
+{
+    return static_cast<T>(static_cast<wrap_type<T>>(x) - static_cast<wrap_type<T>>(y));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate (x * y) with wrapping around like two's complement.
+ * @param[in]  x: lhs of (x * y)
+ * @param[in]  y: rhs of (x * y)
+ * @tparam     T: integer type
+ * @return     the lower bits of (x * y)
+ */
+template <typename T>
+constexpr T wrap_mul(T x, T y) noexcept
+{
+    return static_cast<T>(static_cast<wrap_type<T>>(x) * static_cast<wrap_type<T>>(y));
+}
+/////////////////////////////////////////////////////////////////////////////
+
 } // namespace overflow_detail {
 
 /**
@@ -221,12 +304,16 @@ bool occur_abs(T x, typename std::enable_if<std::is_unsigned<T>::value>::type *
  * @return     true: overflow occurs by (x + y). false: no overflow
  */
 template <typename T>
-bool occur_add(T x, T y) noexcept
+constexpr bool occur_add(T x, T y) noexcept
 {
     static_assert(std::is_integral<T>::value, "Allow only integer");
     static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
 
+#if defined(__GNUC__) && (__GNUC__ >= 7) && !defined(__clang__)
+    return __builtin_add_overflow_p(x, y, T(0));
+#else
     return overflow_detail::occur_add(x, y);
+#endif
 }
 /////////////////////////////////////////////////////////////////////////////
 
@@ -238,12 +325,16 @@ bool occur_add(T x, T y) noexcept
  * @return     true: overflow occurs by (x - y). false: no overflow
  */
 template <typename T>
-bool occur_sub(T x, T y) noexcept
+constexpr bool occur_sub(T x, T y) noexcept
 {
     static_assert(std::is_integral<T>::value, "Allow only integer");
     static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
 
+#if defined(__GNUC__) && (__GNUC__ >= 7) && !defined(__clang__)
+    return __builtin_sub_overflow_p(x, y, T(0));
+#else
     return overflow_detail::occur_sub(x, y);
+#endif
 }
 /////////////////////////////////////////////////////////////////////////////
 
@@ -255,12 +346,16 @@ bool occur_sub(T x, T y) noexcept
  * @return     true: overflow occurs by (x * y). false: no overflow
  */
 template <typename T>
-bool occur_mul(T x, T y) noexcept
+constexpr bool occur_mul(T x, T y) noexcept
 {
     static_assert(std::is_integral<T>::value, "Allow only integer");
     static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
 
+#if defined(__GNUC__) && (__GNUC__ >= 7) && !defined(__clang__)
+    return __builtin_mul_overflow_p(x, y, T(0));
+#else
     return overflow_detail::occur_mul(x, y);
+#endif
 }
 /////////////////////////////////////////////////////////////////////////////
 
@@ -273,7 +368,7 @@ bool occur_mul(T x, T y) noexcept
  * @note       dividing by zero is out of scope of this function (retuen false).
  */
 template <typename T>
-bool occur_div(T x, T y) noexcept
+constexpr bool occur_div(T x, T y) noexcept
 {
     static_assert(std::is_integral<T>::value, "Allow only integer");
     static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
@@ -289,7 +384,7 @@ bool occur_div(T x, T y) noexcept
  * @return     true: overflow occurs by abs(x). false: no overflow
  */
 template <typename T>
-bool occur_abs(T x) noexcept
+constexpr bool occur_abs(T x) noexcept
 {
     static_assert(std::is_integral<T>::value, "Allow only integer");
     static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
@@ -298,6 +393,524 @@ bool occur_abs(T x) noexcept
 }
 /////////////////////////////////////////////////////////////////////////////
 
+/**
+ * @brief      calculate (x + y) and check overflow condition at once.
+ * @param[in]  x: lhs of (x + y)
+ * @param[in]  y: rhs of (x + y)
+ * @param[out] result: (x + y). if overflow occurs, the lower bits of it.
+ * @tparam     T: integer type
+ * @return     true: overflow occurs by (x + y). false: no overflow
+ */
+template <typename T>
+bool checked_add(T x, T y, T& result) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Allow only integer");
+    static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
+
+#if defined(__clang__) || (defined(__GNUC__) && (__GNUC__ >= 5))
+    return __builtin_add_overflow(x, y, &result);
+#else
+    result = overflow_detail::wrap_add(x, y);
+    return overflow_detail::occur_add(x, y);
+#endif
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate (x - y) and check overflow condition at once.
+ * @param[in]  x: lhs of (x - y)
+ * @param[in]  y: rhs of (x - y)
+ * @param[out] result: (x - y). if overflow occurs, the lower bits of it.
+ * @tparam     T: integer type
+ * @return     true: overflow occurs by (x - y). false: no overflow
+ */
+template <typename T>
+bool checked_sub(T x, T y, T& result) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Allow only integer");
+    static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
+
+#if defined(__clang__) || (defined(__GNUC__) && (__GNUC__ >= 5))
+    return __builtin_sub_overflow(x, y, &result);
+#else
+    result = overflow_detail::wrap_sub(x, y);
+    return overflow_detail::occur_sub(x, y);
+#endif
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate (x * y) and check overflow condition at once.
+ * @param[in]  x: lhs of (x * y)
+ * @param[in]  y: rhs of (x * y)
+ * @param[out] result: (x * y). if overflow occurs, the lower bits of it.
+ * @tparam     T: integer type
+ * @return     true: overflow occurs by (x * y). false: no overflow
+ */
+template <typename T>
+bool checked_mul(T x, T y, T& result) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Allow only integer");
+    static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
+
+#if defined(__clang__) || (defined(__GNUC__) && (__GNUC__ >= 5))
+    return __builtin_mul_overflow(x, y, &result);
+#else
+    result = overflow_detail::wrap_mul(x, y);
+    return overflow_detail::occur_mul(x, y);
+#endif
+}
+/////////////////////////////////////////////////////////////////////////////
+
+namespace overflow_detail {
+
+/**
+ * @brief      calculate (x + y) with saturation of signed integer.
+ * @param[in]  x: lhs of (x + y)
+ * @param[in]  y: rhs of (x + y)
+ * @tparam     T: signed integer type
+ * @return     (x + y). maximum or minimum value if overflow occurs.
+ */
+template <typename T>
+constexpr T saturating_add(T x, T y, typename std::enable_if<std::is_signed<T>::value>::type * =nullptr) noexcept
+{
+    using limit = std::numeric_limits<T>;
+
+    return overflow::occur_add(x, y) ? ((y > 0) ? limit::max() : limit::min()) : T(x + y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate (x + y) with saturation of unsigned integer.
+ * @param[in]  x: lhs of (x + y)
+ * @param[in]  y: rhs of (x + y)
+ * @tparam     T: unsigned integer type
+ * @return     (x + y). maximum value if overflow occurs.
+ */
+template <typename T>
+constexpr T saturating_add(T x, T y, typename std::enable_if<std::is_unsigned<T>::value>::type * =nullptr) noexcept
+{
+    using limit = std::numeric_limits<T>;
+
+    return overflow::occur_add(x, y) ? limit::max() : T(x + y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate (x - y) with saturation of signed integer.
+ * @param[in]  x: lhs of (x - y)
+ * @param[in]  y: rhs of (x - y)
+ * @tparam     T: signed integer type
+ * @return     (x - y). maximum or minimum value if overflow occurs.
+ */
+template <typename T>
+constexpr T saturating_sub(T x, T y, typename std::enable_if<std::is_signed<T>::value>::type * =nullptr) noexcept
+{
+    using limit = std::numeric_limits<T>;
+
+    return overflow::occur_sub(x, y) ? ((y < 0) ? limit::max() : limit::min()) : T(x - y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate (x - y) with saturation of unsigned integer.
+ * @param[in]  x: lhs of (x - y)
+ * @param[in]  y: rhs of (x - y)
+ * @tparam     T: unsigned integer type
+ * @return     (x - y). 0 if overflow occurs.
+ */
+template <typename T>
+constexpr T saturating_sub(T x, T y, typename std::enable_if<std::is_unsigned<T>::value>::type * =nullptr) noexcept
+{
+    using limit = std::numeric_limits<T>;
+
+    return overflow::occur_sub(x, y) ? limit::min() : T(x - y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate (x * y) with saturation of signed integer.
+ * @param[in]  x: lhs of (x * y)
+ * @param[in]  y: rhs of (x * y)
+ * @tparam     T: signed integer type
+ * @return     (x * y). maximum or minimum value if overflow occurs.
+ */
+template <typename T>
+constexpr T saturating_mul(T x, T y, typename std::enable_if<std::is_signed<T>::value>::type * =nullptr) noexcept
+{
+    using limit = std::numeric_limits<T>;
+
+    return overflow::occur_mul(x, y) ? (((x < 0) != (y < 0)) ? limit::min() : limit::max()) : T(x * y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate (x * y) with saturation of unsigned integer.
+ * @param[in]  x: lhs of (x * y)
+ * @param[in]  y: rhs of (x * y)
+ * @tparam     T: unsigned integer type
+ * @return     (x * y). maximum value if overflow occurs.
+ */
+template <typename T>
+constexpr T saturating_mul(T x, T y, typename std::enable_if<std::is_unsigned<T>::value>::type * =nullptr) noexcept
+{
+    using limit = std::numeric_limits<T>;
+
+    return overflow::occur_mul(x, y) ? limit::max() : T(x * y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct  use_sse2
+ * @brief   true if batch saturating_add() and saturating_sub() of T use
+ *          SSE2, which has them for 8 and 16 bits integers.
+ */
+template <typename T>
+struct use_sse2 : std::integral_constant<bool,
+#if defined(__SSE2__)
+    sizeof(T) <= 2
+#else
+    false
+#endif
+>
+{
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate x[i] + y[i] with saturation for each element.
+ * @param[in]  x: lhs array
+ * @param[in]  y: rhs array
+ * @param[out] result: result array. it may be same as x or y.
+ * @param[in]  size: the number of elements
+ * @param[in]  dummy: compile switcher. in this case, SSE2 is not used.
+ */
+template <typename T>
+void saturating_add(const T* x, const T* y, T* result, std::size_t size, std::false_type dummy) noexcept
+{
+    for (std::size_t i = 0; i < size; i++) {
+        result[i] = saturating_add(x[i], y[i]);
+    }
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate x[i] - y[i] with saturation for each element.
+ * @param[in]  x: lhs array
+ * @param[in]  y: rhs array
+ * @param[out] result: result array. it may be same as x or y.
+ * @param[in]  size: the number of elements
+ * @param[in]  dummy: compile switcher. in this case, SSE2 is not used.
+ */
+template <typename T>
+void saturating_sub(const T* x, const T* y, T* result, std::size_t size, std::false_type dummy) noexcept
+{
+    for (std::size_t i = 0; i < size; i++) {
+        result[i] = saturating_sub(x[i], y[i]);
+    }
+}
+/////////////////////////////////////////////////////////////////////////////
+
+#if defined(__SSE2__)
+/**
+ * @brief      add 16 bytes with saturation by SSE2.
+ * @param[in]  a: lhs
+ * @param[in]  b: rhs
+ * @tparam     T: 8 or 16 bits integer type of each lane
+ * @return     a + b for each lane
+ */
+template <typename T>
+__m128i adds(__m128i a, __m128i b) noexcept
+{
+    return (sizeof(T) == 1) ? (std::is_signed<T>::value ? _mm_adds_epi8(a, b) : _mm_adds_epu8(a, b)) :
+                              (std::is_signed<T>::value ? _mm_adds_epi16(a, b) : _mm_adds_epu16(a, b));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      subtract 16 bytes with saturation by SSE2.
+ * @param[in]  a: lhs
+ * @param[in]  b: rhs
+ * @tparam     T: 8 or 16 bits integer type of each lane
+ * @return     a - b for each lane
+ */
+template <typename T>
+__m128i subs(__m128i a, __m128i b) noexcept
+{
+    return (sizeof(T) == 1) ? (std::is_signed<T>::value ? _mm_subs_epi8(a, b) : _mm_subs_epu8(a, b)) :
+                              (std::is_signed<T>::value ? _mm_subs_epi16(a, b) : _mm_subs_epu16(a, b));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate x[i] + y[i] with saturation for each element by SSE2.
+ *             16 bytes are calculated at once, and the rest one by one.
+ * @param[in]  x: lhs array
+ * @param[in]  y: rhs array
+ * @param[out] result: result array. it may be same as x or y.
+ * @param[in]  size: the number of elements
+ * @param[in]  dummy: compile switcher. in this case, SSE2 is used.
+ */
+template <typename T>
+void saturating_add(const T* x, const T* y, T* result, std::size_t size, std::true_type dummy) noexcept
+{
+    const std::size_t lanes = sizeof(__m128i) / sizeof(T);
+    std::size_t i = 0;
+    for (; i + lanes <= size; i += lanes) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(result + i), adds<T>(a, b));
+    }
+    saturating_add(x + i, y + i, result + i, size - i, std::false_type{});
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate x[i] - y[i] with saturation for each element by SSE2.
+ *             16 bytes are calculated at once, and the rest one by one.
+ * @param[in]  x: lhs array
+ * @param[in]  y: rhs array
+ * @param[out] result: result array. it may be same as x or y.
+ * @param[in]  size: the number of elements
+ * @param[in]  dummy: compile switcher. in this case, SSE2 is used.
+ */
+template <typename T>
+void saturating_sub(const T* x, const T* y, T* result, std::size_t size, std::true_type dummy) noexcept
+{
+    const std::size_t lanes = sizeof(__m128i) / sizeof(T);
+    std::size_t i = 0;
+    for (; i + lanes <= size; i += lanes) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(result + i), subs<T>(a, b));
+    }
+    saturating_sub(x + i, y + i, result + i, size - i, std::false_type{});
+}
+/////////////////////////////////////////////////////////////////////////////
+#endif
+
+} // namespace overflow_detail {
+
+/**
+ * @brief      calculate (x + y) with wrapping around like two's complement.
+ * @param[in]  x: lhs of (x + y)
+ * @param[in]  y: rhs of (x + y)
+ * @tparam     T: integer type
+ * @return     the lower bits of (x + y)
+ */
+template <typename T>
+constexpr T wrapping_add(T x, T y) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Allow only integer");
+    static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
+
+    return overflow_detail::wrap_add(x, y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate (x - y) with wrapping around like two's complement.
+ * @param[in]  x: lhs of (x - y)
+ * @param[in]  y: rhs of (x - y)
+ * @tparam     T: integer type
+ * @return     the lower bits of (x - y)
+ */
+template <typename T>
+constexpr T wrapping_sub(T x, T y) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Allow only integer");
+    static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
+
+    return overflow_detail::wrap_sub(x, y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate (x * y) with wrapping around like two's complement.
+ * @param[in]  x: lhs of (x * y)
+ * @param[in]  y: rhs of (x * y)
+ * @tparam     T: integer type
+ * @return     the lower bits of (x * y)
+ */
+template <typename T>
+constexpr T wrapping_mul(T x, T y) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Allow only integer");
+    static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
+
+    return overflow_detail::wrap_mul(x, y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate (x + y) with saturation.
+ * @param[in]  x: lhs of (x + y)
+ * @param[in]  y: rhs of (x + y)
+ * @tparam     T: integer type
+ * @return     (x + y). the nearest limit of T if overflow occurs.
+ */
+template <typename T>
+constexpr T saturating_add(T x, T y) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Allow only integer");
+    static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
+
+    return overflow_detail::saturating_add(x, y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate (x - y) with saturation.
+ * @param[in]  x: lhs of (x - y)
+ * @param[in]  y: rhs of (x - y)
+ * @tparam     T: integer type
+ * @return     (x - y). the nearest limit of T if overflow occurs.
+ */
+template <typename T>
+constexpr T saturating_sub(T x, T y) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Allow only integer");
+    static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
+
+    return overflow_detail::saturating_sub(x, y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate (x * y) with saturation.
+ * @param[in]  x: lhs of (x * y)
+ * @param[in]  y: rhs of (x * y)
+ * @tparam     T: integer type
+ * @return     (x * y). the nearest limit of T if overflow occurs.
+ */
+template <typename T>
+constexpr T saturating_mul(T x, T y) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Allow only integer");
+    static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
+
+    return overflow_detail::saturating_mul(x, y);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate x[i] + y[i] with wrapping around for each element.
+ * @param[in]  x: lhs array
+ * @param[in]  y: rhs array
+ * @param[out] result: result array. it may be same as x or y.
+ * @param[in]  size: the number of elements
+ * @tparam     T: integer type
+ */
+template <typename T>
+void wrapping_add(const T* x, const T* y, T* result, std::size_t size) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Allow only integer");
+    static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
+
+    for (std::size_t i = 0; i < size; i++) {
+        result[i] = overflow_detail::wrap_add(x[i], y[i]);
+    }
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate x[i] - y[i] with wrapping around for each element.
+ * @param[in]  x: lhs array
+ * @param[in]  y: rhs array
+ * @param[out] result: result array. it may be same as x or y.
+ * @param[in]  size: the number of elements
+ * @tparam     T: integer type
+ */
+template <typename T>
+void wrapping_sub(const T* x, const T* y, T* result, std::size_t size) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Allow only integer");
+    static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
+
+    for (std::size_t i = 0; i < size; i++) {
+        result[i] = overflow_detail::wrap_sub(x[i], y[i]);
+    }
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate x[i] * y[i] with wrapping around for each element.
+ * @param[in]  x: lhs array
+ * @param[in]  y: rhs array
+ * @param[out] result: result array. it may be same as x or y.
+ * @param[in]  size: the number of elements
+ * @tparam     T: integer type
+ */
+template <typename T>
+void wrapping_mul(const T* x, const T* y, T* result, std::size_t size) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Allow only integer");
+    static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
+
+    for (std::size_t i = 0; i < size; i++) {
+        result[i] = overflow_detail::wrap_mul(x[i], y[i]);
+    }
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate x[i] + y[i] with saturation for each element.
+ *             8 and 16 bits integers are calculated by SSE2 if available.
+ * @param[in]  x: lhs array
+ * @param[in]  y: rhs array
+ * @param[out] result: result array. it may be same as x or y.
+ * @param[in]  size: the number of elements
+ * @tparam     T: integer type
+ */
+template <typename T>
+void saturating_add(const T* x, const T* y, T* result, std::size_t size) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Allow only integer");
+    static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
+
+    overflow_detail::saturating_add(x, y, result, size, overflow_detail::use_sse2<T>{});
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate x[i] - y[i] with saturation for each element.
+ *             8 and 16 bits integers are calculated by SSE2 if available.
+ * @param[in]  x: lhs array
+ * @param[in]  y: rhs array
+ * @param[out] result: result array. it may be same as x or y.
+ * @param[in]  size: the number of elements
+ * @tparam     T: integer type
+ */
+template <typename T>
+void saturating_sub(const T* x, const T* y, T* result, std::size_t size) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Allow only integer");
+    static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
+
+    overflow_detail::saturating_sub(x, y, result, size, overflow_detail::use_sse2<T>{});
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      calculate x[i] * y[i] with saturation for each element.
+ * @param[in]  x: lhs array
+ * @param[in]  y: rhs array
+ * @param[out] result: result array. it may be same as x or y.
+ * @param[in]  size: the number of elements
+ * @tparam     T: integer type
+ */
+template <typename T>
+void saturating_mul(const T* x, const T* y, T* result, std::size_t size) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Allow only integer");
+    static_assert(not std::is_same<T, bool>::value, "bool is not allowed");
+
+    for (std::size_t i = 0; i < size; i++) {
+        result[i] = overflow_detail::saturating_mul(x[i], y[i]);
+    }
+}
+/////////////////////////////////////////////////////////////////////////////
+
 } // namespace overflow {
 } // namespace ken3 {
 
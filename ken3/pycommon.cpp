@@ -5,6 +5,7 @@
  *          ken3::py::ValueError <=> python's ValueError
  *          ken3::py::IndexError <=> python's IndexError
  *          ken3::py::TypeError <=> python's TypeError
+ *          ken3::py::OverflowError <=> python's OverflowError
  * @author  toda
  * @date    2019-12-22
  * @version 0.1.0
@@ -61,5 +62,16 @@ TypeError::TypeError(const std::string& msg) :
 }
 /////////////////////////////////////////////////////////////////////////////
 
+/**
+ * @brief       constructor. 
+ * @param[in]   msg: message for what(). 
+ */
+OverflowError::OverflowError(const std::string& msg) :
+    Exception(std::string("OverflowError: ") + msg)
+{
+    ;
+}
+/////////////////////////////////////////////////////////////////////////////
+
 } // namespace py {
 } // namespace ken3 {
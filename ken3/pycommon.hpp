@@ -5,6 +5,7 @@
  *          ken3::py::ValueError <=> python's ValueError
  *          ken3::py::IndexError <=> python's IndexError
  *          ken3::py::TypeError <=> python's TypeError
+ *          ken3::py::OverflowError <=> python's OverflowError
  * @author  toda
  * @date    2019-12-22
  * @version 0.1.0
@@ -79,6 +80,21 @@ struct TypeError : public Exception
 };
 /////////////////////////////////////////////////////////////////////////////
 
+/**
+ * @class OverflowError
+ * @brief An exception which imitates Python OverflowError. 
+ * @extends ken3::py::Exception. 
+ */
+struct OverflowError : public Exception
+{
+    /**
+     * @brief       constructor. 
+     * @param[in]   msg: message for what(). 
+     */
+    explicit OverflowError(const std::string& msg);
+};
+/////////////////////////////////////////////////////////////////////////////
+
 } // namespace py {
 } // namespace ken3 {
 
@@ -8,49 +8,118 @@
  */
 
 #include <stdio.h>
+#include <stdint.h>
 #include <string.h>
 #include <algorithm>
 #include <cctype>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 #include "ken3/pystr.hpp"
 
 namespace {
 
 /**
- * @brief     helper function to convert a characer into std::string for repr().
- * @param[in] c: appointed character
- * @return    converted string. it consists of three kinds.
+ * @struct    repr_table
+ * @brief     escaped expression of each byte for repr(). size is 0 if the
+ *            byte is printed as it is. it consists of three kinds.
  *            1) escape characters ex.) "\\t" whose length is 2
  *            2) binary expression ex.) "\\x2a" whose length is 4 and in lower case
- *            3) ascii characters ex.) "A"
+ *            3) ascii characters, whose size is 0
  */
-std::string conv_repr(char c)
+struct repr_table
 {
-    // special escape characters
-    static const struct {
-        char c;
-        const char* const escaped;
-    } _esc[] = {
-        {'\t', "\\t"}, {'\n', "\\n"}, {'\r', "\\r"}, {'\\', "\\\\"},
-    };
-    for (const auto& i: _esc) {
-        if (c == i.c) {
-            return i.escaped;
+    repr_table(void)
+    {
+        for (int i = 0; i < 256; i++) {
+            size[i] = 0;
+            if ((i < 0x20) || (i >= 0x7f)) {
+                size[i] = static_cast<unsigned char>(sprintf(text[i], "\\x%02x", i));
+            }
+        }
+
+        // special escape characters
+        static const struct {
+            char c;
+            const char* const escaped;
+        } _esc[] = {
+            {'\t', "\\t"}, {'\n', "\\n"}, {'\r', "\\r"}, {'\\', "\\\\"},
+        };
+        for (const auto& i: _esc) {
+            size[static_cast<unsigned char>(i.c)] = 2;
+            memcpy(text[static_cast<unsigned char>(i.c)], i.escaped, 3);
         }
     }
 
-    // non-ascci characters. return string which starts with "\\x"
-    unsigned char uc;
-    memcpy(&uc, &c, sizeof(uc));
-    if ((uc < 0x20) || (uc >= 0x7f)) {
-        char buf[16] = {'\0'};
-        sprintf(buf, "\\x%02x", uc);
-        return buf;
+    unsigned char size[256];
+    char text[256][8];
+};
+/////////////////////////////////////////////////////////////////////////////
+
+#if defined(__SSE2__)
+/**
+ * @brief     size of bytes which may_escape() judges at once.
+ */
+const std::string::size_type escape_block = 16;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief     helper function to judge whether 16 bytes may include a byte
+ *            which repr() escapes, by SSE2.
+ * @param[in] data: head of 16 bytes
+ * @param[in] quote: true if \' is also escaped
+ * @return    true: may include, false: not include
+ */
+inline bool may_escape(const char* data, bool quote)
+{
+    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+
+    // as signed bytes, both 0x00-0x1f and 0x80-0xff are less than 0x20.
+    __m128i found = _mm_or_si128(_mm_cmplt_epi8(x, _mm_set1_epi8(0x20)),
+                                 _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x7f)),
+                                              _mm_cmpeq_epi8(x, _mm_set1_epi8('\\'))));
+    if (quote) {
+        found = _mm_or_si128(found, _mm_cmpeq_epi8(x, _mm_set1_epi8('\'')));
     }
+    return _mm_movemask_epi8(found) != 0;
+}
+/////////////////////////////////////////////////////////////////////////////
+#else
+/**
+ * @brief     size of bytes which may_escape() judges at once.
+ */
+const std::string::size_type escape_block = sizeof(uint64_t);
+/////////////////////////////////////////////////////////////////////////////
 
-    // ascci characters
-    return std::string(1, c);
+/**
+ * @brief     helper function to judge whether 8 bytes may include a byte
+ *            which repr() escapes. it is a portable SIMD within a register.
+ * @param[in] data: head of 8 bytes
+ * @param[in] quote: true if \' is also escaped
+ * @return    true: may include, false: not include
+ */
+inline bool may_escape(const char* data, bool quote)
+{
+    uint64_t word;
+    memcpy(&word, data, sizeof(word));
+
+    const uint64_t ones = 0x0101010101010101ULL;
+    const uint64_t highs = 0x8080808080808080ULL;
+
+    // a byte is zero <=> (x - 1) & ~x has its highest bit.
+    // a byte is less than 0x20 <=> (x - 0x20) & ~x has its highest bit.
+    uint64_t del = word ^ (ones * 0x7f);
+    uint64_t bs = word ^ (ones * '\\');
+    uint64_t found = (word | ((word - ones * 0x20) & ~word) |
+                      ((del - ones) & ~del) | ((bs - ones) & ~bs)) & highs;
+    if (quote) {
+        uint64_t q = word ^ (ones * '\'');
+        found |= ((q - ones) & ~q) & highs;
+    }
+    return found != 0;
 }
 /////////////////////////////////////////////////////////////////////////////
+#endif
 
 /**
  * @brief     helper function to judge whether all {start, end, step} are
@@ -387,25 +456,46 @@ bool ne(const std::string& self, const std::string& x) noexcept
  */
 std::string repr(const std::string& self)
 {
-    std::string ret;
-    ret.reserve(self.size() + 2);
+    static const repr_table table;
 
-    for (const auto& i: self) {
-        ret += conv_repr(i);
-    }
+    // select quotation. if both quotations are included, \' is escaped.
+    bool single = (memchr(self.data(), '\'', self.size()) != nullptr);
+    bool both = single && (memchr(self.data(), '"', self.size()) != nullptr);
+    char quotation = (single && !both) ? '"' : '\'';
 
-    if (ret.find("'") == std::string::npos) {
-        ret = std::string("'") + ret + std::string("'");
-    }
-    else {
-        if (ret.find('"') == std::string::npos) {
-            ret = std::string("\"") + ret + std::string("\"");
+    std::string ret;
+    ret.reserve(self.size() + 2);
+    ret += quotation;
+
+    // copy runs of characters which are not escaped in bulk
+    const char* data = self.data();
+    std::string::size_type size = self.size();
+    std::string::size_type run = 0;
+    std::string::size_type i = 0;
+    while (i < size) {
+        if ((i + escape_block <= size) && !may_escape(data + i, both)) {
+            i += escape_block;
+            continue;
         }
-        else {
-            ret = std::string("'") + replace(ret, "'", "\\'") + std::string("'");
+
+        std::string::size_type last = std::min(size, i + escape_block);
+        for (; i < last; i++) {
+            unsigned char c = static_cast<unsigned char>(data[i]);
+            if ((table.size[c] != 0) || (both && (c == '\''))) {
+                ret.append(data + run, i - run);
+                if (table.size[c] != 0) {
+                    ret.append(table.text[c], table.size[c]);
+                }
+                else {
+                    ret.append("\\'", 2);
+                }
+                run = i + 1;
+            }
         }
     }
+    ret.append(data + run, size - run);
 
+    ret += quotation;
     return ret;
 }
 /////////////////////////////////////////////////////////////////////////////
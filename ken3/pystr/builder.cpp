@@ -0,0 +1,307 @@
+/**
+ * @file    ken3/pystr/builder.cpp
+ * @brief   Implementation of string builder and pystr functions for it.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "ken3/pycommon.hpp"
+#include "ken3/pystr/builder.hpp"
+
+namespace ken3 {
+namespace pystr {
+
+namespace {
+
+/**
+ * @brief   maximum size of a text piece, which append() of builder copies
+ *          instead of sharing. larger pieces are shared as a group, otherwise
+ *          a prepending loop copies the whole text in each iteration.
+ */
+constexpr std::string::size_type flatten_limit = 256;
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace {
+
+/**
+ * @brief      destructor. the list and groups are released without recursion.
+ */
+builder::node::~node(void) noexcept
+{
+    // a long list or deeply nested groups would overflow the stack by
+    // recursive destructors. nodes which no other builder refers to are
+    // moved into pending, and released after their links are taken.
+    std::vector<std::shared_ptr<node>> pending;
+    auto release = [&pending](std::shared_ptr<node>& p) noexcept {
+        if (p && (p.use_count() == 1)) {
+            try {
+                pending.push_back(std::move(p));
+            }
+            catch (...) {
+                // p is released recursively if pending cannot grow
+                ;
+            }
+        }
+        p.reset();
+    };
+    release(prev);
+    release(value.group);
+    while (!pending.empty()) {
+        std::shared_ptr<node> p = std::move(pending.back());
+        pending.pop_back();
+        release(p->prev);
+        release(p->value.group);
+    }
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      constructor with initial string.
+ * @param[in]  s: initial string.
+ */
+builder::builder(const std::string& s)
+{
+    append(s);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      constructor with initial string.
+ * @param[in]  s: initial string.
+ */
+builder::builder(std::string&& s)
+{
+    if (!s.empty()) {
+        size_ = s.size();
+        push(piece{std::move(s), nullptr, size_, 1});
+    }
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      append a string.
+ * @param[in]  x: appended string.
+ * @return     *this
+ */
+builder& builder::append(const std::string& x)
+{
+    if (x.empty()) {
+        return *this;
+    }
+
+    // consecutive strings are merged into one text piece, unless another
+    // builder shares the last piece
+    if (last_ && (last_.use_count() == 1) && !last_->value.group && (last_->value.repeat == 1)) {
+        last_->value.text += x;
+        last_->value.size += x.size();
+    }
+    else {
+        push(piece{x, nullptr, x.size(), 1});
+    }
+    size_ += x.size();
+    return *this;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      append another builder. recorded groups are shared, not copied.
+ * @param[in]  x: appended builder.
+ * @return     *this
+ */
+builder& builder::append(const builder& x)
+{
+    if (this == &x) {
+        return repeat(2);
+    }
+    else if (!x.last_) {
+        return *this;
+    }
+    else if (!x.last_->prev && !x.last_->value.group && (x.last_->value.repeat == 1) &&
+             (x.last_->value.size <= flatten_limit)) {
+        return append(x.last_->value.text);
+    }
+
+    push(piece{std::string(), x.last_, x.size_, 1});
+    size_ += x.size_;
+    return *this;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      repeat whole recorded data n times.
+ * @param[in]  n: repeat count. if n <= 0, builder becomes empty.
+ * @return     *this
+ * @throw      ken3::py::OverflowError: when the size exceeds std::string::max_size().
+ */
+builder& builder::repeat(index_type n)
+{
+    if ((n <= 0) || !last_) {
+        last_.reset();
+        size_ = 0;
+        return *this;
+    }
+    if (n == 1) {
+        return *this;
+    }
+    if (size_ > std::string().max_size() / static_cast<std::string::size_type>(n)) {
+        throw ken3::py::OverflowError("repeated string is too long");
+    }
+
+    if (!last_->prev && (last_.use_count() == 1)) {
+        last_->value.repeat *= n;
+    }
+    else {
+        last_ = std::make_shared<node>(piece{std::string(), std::move(last_), size_, n}, nullptr);
+    }
+    size_ *= n;
+    return *this;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      materialize string.
+ * @return     built string.
+ */
+std::string builder::str(void) const
+{
+    std::string out;
+    out.reserve(size_);
+    render(last_.get(), out);
+    return out;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      add a piece after the last one.
+ * @param[in]  p: added piece.
+ */
+void builder::push(piece&& p)
+{
+    last_ = std::make_shared<node>(std::move(p), std::move(last_));
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      write pieces into a string.
+ * @param[in]  last: the last node of appointed pieces.
+ * @param[in,out] out: destination. its capacity should be enough.
+ */
+void builder::render(const node* last, std::string& out)
+{
+    // groups may be nested deeply, thus pieces are kept in a stack instead
+    // of recursion. npos means the piece is not written yet, otherwise it
+    // is the position where the written piece begins.
+    std::vector<std::pair<const piece*, std::string::size_type>> stack;
+    auto push_list = [&stack](const node* i) {
+        for (; i != nullptr; i = i->prev.get()) {
+            stack.emplace_back(&i->value, std::string::npos);
+        }
+    };
+    push_list(last);
+
+    while (!stack.empty()) {
+        const piece* p = stack.back().first;
+        std::string::size_type first = stack.back().second;
+        stack.pop_back();
+        if (first == std::string::npos) {
+            stack.emplace_back(p, out.size());
+            if (p->group) {
+                push_list(p->group.get());
+            }
+            else {
+                out += p->text;
+            }
+            continue;
+        }
+
+        // copy already written data, doubling the size of each copy
+        std::string::size_type total = p->size * p->repeat;
+        std::string::size_type written = p->size;
+        while (written < total) {
+            std::string::size_type n = std::min(written, total - written);
+            out.append(out, first, n);
+            written += n;
+        }
+    }
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.__add__() with builder
+ *        pystr::add(builder("abc"), "a") <=> 'abc' + 'a'
+ */
+builder add(builder self, const std::string& x)
+{
+    self.append(x);
+    return self;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.__add__() with builder
+ *        pystr::add(builder("abc"), builder("a")) <=> 'abc' + 'a'
+ */
+builder add(builder self, const builder& x)
+{
+    self.append(x);
+    return self;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.join() with builder
+ *        pystr::join("abc", {builder("a"), builder("b")}) <=> 'abc'.join(['a', 'b'])
+ */
+builder join(const std::string& self, const std::vector<builder>& strs)
+{
+    builder retval;
+    for (auto i = strs.cbegin(); i != strs.cend(); ++i) {
+        if (i != strs.cbegin()) {
+            retval.append(self);
+        }
+        retval.append(*i);
+    }
+    return retval;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.__len__() with builder
+ *        pystr::len(builder("abc")) <=> len('abc')
+ */
+index_type len(const builder& self) noexcept
+{
+    return static_cast<index_type>(self.size());
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.__mul__() with builder
+ *        pystr::mul(builder("abc"), 3) <=> 'abc' * 3
+ */
+builder mul(builder self, index_type n)
+{
+    self.repeat(n);
+    return self;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.__rmul__() with builder
+ *        pystr::rmul(builder("abc"), 3) <=> 3 * 'abc'
+ */
+builder rmul(builder self, index_type n)
+{
+    self.repeat(n);
+    return self;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace pystr {
+} // namespace ken3 {
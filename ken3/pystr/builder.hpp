@@ -0,0 +1,243 @@
+/**
+ * @file    ken3/pystr/builder.hpp
+ * @brief   Define string builder and pystr functions for it.
+ *          pystr::builder records appends and repeats, and materializes
+ *          std::string at once.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more.
+ *
+ * @note
+ * Typical usage is;
+ *     ken3::pystr::builder b;
+ *     for (const auto& i: {"a", "b", "c"}) {
+ *         b = ken3::pystr::add(b, i);
+ *     }
+ *     b = ken3::pystr::mul(b, 2);
+ *     std::cout << b.str(); // => "abcabc"
+ *
+ * pystr::add(), pystr::mul(), pystr::rmul(), and pystr::join() with
+ * builder return builder instead of std::string. Those functions do not
+ * copy repeated data, thus the cost of building is linear in the number
+ * of appended bytes. recorded pieces are immutable and shared by copies,
+ * thus copying builder costs O(1), and b = add(b, x) is also linear.
+ * only the last text piece which no other builder refers to is extended
+ * in place. an appended builder is shared as a group, except a small text
+ * piece, which is copied. groups may be nested deeply, because they are
+ * rendered and released without recursion. mul() throws ken3::py::OverflowError if the size of the built
+ * string exceeds std::string::max_size().
+ */
+
+#ifndef INCLUDE_GUARD_KEN3_PYSTR_BUILDER_HPP
+#define INCLUDE_GUARD_KEN3_PYSTR_BUILDER_HPP
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "ken3/pystr.hpp"
+
+namespace ken3 {
+namespace pystr {
+
+/**
+ * @class   builder
+ * @brief   piece table of string. each piece is a string or a group of
+ *          pieces, and it has its own repeat count.
+ */
+class builder
+{
+private:
+    struct node;
+
+    /**
+     * @struct  piece
+     * @brief   a part of builder. if group is nullptr, the piece is text.
+     *          otherwise the piece is group, which is the last node of
+     *          pieces. size is size of one repeat.
+     */
+    struct piece
+    {
+        std::string text;
+        std::shared_ptr<node> group;
+        std::string::size_type size;
+        index_type repeat;
+    };
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @struct  node
+     * @brief   a node of singly linked list of pieces from the last one.
+     *          nodes are shared by copies of builder.
+     */
+    struct node
+    {
+        /**
+         * @brief      constructor.
+         * @param[in]  v: piece of this node.
+         * @param[in]  p: previous node.
+         */
+        node(piece&& v, std::shared_ptr<node>&& p) :
+            value(std::move(v)),
+            prev(std::move(p))
+        {
+            ;
+        }
+
+        /**
+         * @brief      destructor. the list is released without recursion.
+         */
+        ~node(void) noexcept;
+
+        piece value;
+        std::shared_ptr<node> prev;
+    };
+    /////////////////////////////////////////////////////////////////////////////
+
+public:
+    /**
+     * @brief      default constructor. empty builder is constructed.
+     */
+    builder(void) = default;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with initial string.
+     * @param[in]  s: initial string.
+     */
+    explicit builder(const std::string& s);
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with initial string.
+     * @param[in]  s: initial string.
+     */
+    explicit builder(std::string&& s);
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      copy constructor, move constructor, destructor, copy operator=,
+     *             and move operator= are nothing special.
+     */
+    builder(const builder& src) = default;
+    builder(builder&& src) noexcept = default;
+    ~builder(void) noexcept = default;
+    builder& operator=(const builder& rhs) = default;
+    builder& operator=(builder&& rhs) noexcept = default;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      append a string.
+     * @param[in]  x: appended string.
+     * @return     *this
+     */
+    builder& append(const std::string& x);
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      append another builder. recorded groups are shared, not copied.
+     * @param[in]  x: appended builder.
+     * @return     *this
+     */
+    builder& append(const builder& x);
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      repeat whole recorded data n times.
+     * @param[in]  n: repeat count. if n <= 0, builder becomes empty.
+     * @return     *this
+     * @throw      ken3::py::OverflowError: when the size exceeds std::string::max_size().
+     */
+    builder& repeat(index_type n);
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      getter of size of materialized string.
+     * @return     size of materialized string.
+     */
+    std::string::size_type size(void) const noexcept
+    {
+        return size_;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      materialize string.
+     * @return     built string.
+     */
+    std::string str(void) const;
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    /**
+     * @brief      add a piece after the last one.
+     * @param[in]  p: added piece.
+     */
+    void push(piece&& p);
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      write pieces into a string.
+     * @param[in]  last: the last node of appointed pieces.
+     * @param[in,out] out: destination. its capacity should be enough.
+     */
+    static void render(const node* last, std::string& out);
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    std::shared_ptr<node> last_;
+    std::string::size_type size_ = 0;
+    /////////////////////////////////////////////////////////////////////////////
+
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.__add__() with builder
+ *        pystr::add(builder("abc"), "a") <=> 'abc' + 'a'
+ */
+builder add(builder self, const std::string& x);
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.__add__() with builder
+ *        pystr::add(builder("abc"), builder("a")) <=> 'abc' + 'a'
+ */
+builder add(builder self, const builder& x);
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.join() with builder
+ *        pystr::join("abc", {builder("a"), builder("b")}) <=> 'abc'.join(['a', 'b'])
+ */
+builder join(const std::string& self, const std::vector<builder>& strs);
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.__len__() with builder
+ *        pystr::len(builder("abc")) <=> len('abc')
+ */
+index_type len(const builder& self) noexcept;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.__mul__() with builder
+ *        pystr::mul(builder("abc"), 3) <=> 'abc' * 3
+ * @throw ken3::py::OverflowError: when the size exceeds std::string::max_size().
+ */
+builder mul(builder self, index_type n);
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.__rmul__() with builder
+ *        pystr::rmul(builder("abc"), 3) <=> 3 * 'abc'
+ * @throw ken3::py::OverflowError: when the size exceeds std::string::max_size().
+ */
+builder rmul(builder self, index_type n);
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace pystr {
+} // namespace ken3 {
+
+#endif // #ifndef INCLUDE_GUARD_KEN3_PYSTR_BUILDER_HPP
@@ -0,0 +1,216 @@
+/**
+ * @file    ken3/pystr/intern.cpp
+ * @brief   Implementation of interned string table and pystr functions for it.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more.
+ */
+
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include "ken3/pystr.hpp"
+#include "ken3/pystr/intern.hpp"
+
+namespace {
+
+using ken3::pystr::interned;
+using ken3::pystr::intern_detail::entry;
+using ken3::pystr::intern_detail::transform;
+
+/**
+ * @brief     the number of shards of intern table. each shard has own mutex
+ *            to reduce lock contention.
+ */
+constexpr std::size_t shard_size = 16;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief     a part of intern table. the key of map is interned string itself.
+ *            std::unordered_map never moves its elements, so pointers to
+ *            the elements are stable.
+ */
+struct shard
+{
+    std::mutex mutex;
+    std::unordered_map<std::string, entry> map;
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief     getter of intern table.
+ * @return    intern table, which is made at first call.
+ */
+shard* table(void)
+{
+    static shard shards[shard_size];
+    return shards;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief     helper function to get cached transform result, or to make it.
+ * @param[in] self: appointed interned string
+ * @param[in] kind: kind of transform
+ * @param[in] func: transform function. called only if not cached yet.
+ * @return    interned result of transform
+ */
+interned cached(interned self, transform kind, std::string (*func)(const std::string&))
+{
+    std::atomic<const entry*>& c = self.get()->cache[static_cast<std::size_t>(kind)];
+
+    const entry* e = c.load(std::memory_order_acquire);
+    if (e == nullptr) {
+        // several threads may reach here at the same time, but all of them
+        // store the same entry because the result is interned.
+        e = ken3::pystr::intern(func(self.str())).get();
+        c.store(e, std::memory_order_release);
+    }
+    return interned(e);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace {
+
+namespace ken3 {
+namespace pystr {
+
+/**
+ * @brief      default constructor. handle of empty string is constructed.
+ */
+interned::interned(void) :
+    e_(intern(std::string()).get())
+{
+    ;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief intern a string.
+ *        pystr::intern("abc") <=> sys.intern('abc')
+ */
+interned intern(const std::string& self)
+{
+    shard& s = table()[std::hash<std::string>()(self) % shard_size];
+
+    std::lock_guard<std::mutex> lock(s.mutex);
+    auto found = s.map.find(self);
+    if (found == s.map.end()) {
+        found = s.map.emplace(std::piecewise_construct,
+                              std::forward_as_tuple(self),
+                              std::forward_as_tuple()).first;
+        found->second.value = &found->first;
+        for (auto& i: found->second.cache) {
+            i.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    return interned(&found->second);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.capitalize() with interned string. the result is cached.
+ *        pystr::capitalize(intern("abc")) <=> 'abc'.capitalize()
+ */
+interned capitalize(interned self)
+{
+    return cached(self, transform::capitalize, capitalize);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.casefold() with interned string. the result is cached.
+ *        pystr::casefold(intern("abc")) <=> 'abc'.casefold()
+ */
+interned casefold(interned self)
+{
+    return cached(self, transform::casefold, casefold);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.lower() with interned string. the result is cached.
+ *        pystr::lower(intern("abc")) <=> 'abc'.lower()
+ */
+interned lower(interned self)
+{
+    return cached(self, transform::lower, lower);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.lstrip() with interned string.
+ *        pystr::lstrip(intern("  abc")) <=> '  abc'.lstrip()
+ * @note  the result is cached only when chars is default.
+ */
+interned lstrip(interned self, const std::string& chars/*=std::string(" ")*/)
+{
+    if (chars != " ") {
+        return intern(lstrip(self.str(), chars));
+    }
+    return cached(self, transform::lstrip, [](const std::string& s) { return lstrip(s); });
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.rstrip() with interned string.
+ *        pystr::rstrip(intern("abc  ")) <=> 'abc  '.rstrip()
+ * @note  the result is cached only when chars is default.
+ */
+interned rstrip(interned self, const std::string& chars/*=std::string(" ")*/)
+{
+    if (chars != " ") {
+        return intern(rstrip(self.str(), chars));
+    }
+    return cached(self, transform::rstrip, [](const std::string& s) { return rstrip(s); });
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.strip() with interned string.
+ *        pystr::strip(intern(" abc ")) <=> ' abc '.strip()
+ * @note  the result is cached only when chars is default.
+ */
+interned strip(interned self, const std::string& chars/*=std::string(" ")*/)
+{
+    if (chars != " ") {
+        return intern(strip(self.str(), chars));
+    }
+    return cached(self, transform::strip, [](const std::string& s) { return strip(s); });
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.swapcase() with interned string. the result is cached.
+ *        pystr::swapcase(intern("abc")) <=> 'abc'.swapcase()
+ */
+interned swapcase(interned self)
+{
+    return cached(self, transform::swapcase, swapcase);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.title() with interned string. the result is cached.
+ *        pystr::title(intern("abc")) <=> 'abc'.title()
+ */
+interned title(interned self)
+{
+    return cached(self, transform::title, title);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.upper() with interned string. the result is cached.
+ *        pystr::upper(intern("abc")) <=> 'abc'.upper()
+ */
+interned upper(interned self)
+{
+    return cached(self, transform::upper, upper);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace pystr {
+} // namespace ken3 {
@@ -0,0 +1,279 @@
+/**
+ * @file    ken3/pystr/intern.hpp
+ * @brief   Define interned string handle and pystr functions for it.
+ *          Interned strings are kept in a process wide table, so the same
+ *          contents always get the same handle.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more.
+ *
+ * @note
+ * Typical usage is;
+ *     ken3::pystr::interned a = ken3::pystr::intern("  Key ");
+ *     ken3::pystr::interned b = ken3::pystr::intern("key");
+ *     std::cout << ken3::pystr::eq(ken3::pystr::lower(ken3::pystr::strip(a)), b); // => true
+ *
+ * Transform results (lower(), upper(), strip(), ...) are cached in each
+ * interned entry. Thus, repeated normalizations of the same key are only
+ * an atomic load after the first call. eq() of two handles is a pointer
+ * comparison.
+ * All functions are thread-safe. Interned entries are never released.
+ */
+
+#ifndef INCLUDE_GUARD_KEN3_PYSTR_INTERN_HPP
+#define INCLUDE_GUARD_KEN3_PYSTR_INTERN_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace ken3 {
+namespace pystr {
+namespace intern_detail {
+
+/**
+ * @enum    transform
+ * @brief   kinds of cached transforms. size is the number of kinds.
+ */
+enum class transform
+{
+    capitalize = 0,
+    casefold,
+    lower,
+    lstrip,
+    rstrip,
+    strip,
+    swapcase,
+    title,
+    upper,
+    size,
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct  entry
+ * @brief   an element of intern table.
+ *          value points to the key string of intern table, which never moves.
+ *          cache keeps results of transforms. nullptr means not cached yet.
+ */
+struct entry
+{
+    const std::string* value;
+    mutable std::atomic<const entry*> cache[static_cast<std::size_t>(transform::size)];
+};
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace intern_detail {
+
+/**
+ * @class   interned
+ * @brief   handle of an interned string. Copying a handle is copying a pointer.
+ *          Two handles are equal if and only if their contents are equal.
+ */
+class interned
+{
+public:
+    /**
+     * @brief      default constructor. handle of empty string is constructed.
+     */
+    interned(void);
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      constructor with an entry of intern table.
+     * @param[in]  e: appointed entry. should not be nullptr.
+     * @note       normally, use ken3::pystr::intern() instead of this.
+     */
+    explicit interned(const intern_detail::entry* e) noexcept :
+        e_(e)
+    {
+        ;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      copy constructor, move constructor, destructor, copy operator=,
+     *             and move operator= are nothing special.
+     */
+    interned(const interned& src) noexcept = default;
+    interned(interned&& src) noexcept = default;
+    ~interned(void) noexcept = default;
+    interned& operator=(const interned& rhs) noexcept = default;
+    interned& operator=(interned&& rhs) noexcept = default;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      getter of interned string.
+     * @return     interned string. the reference is valid until the process ends.
+     */
+    const std::string& str(void) const noexcept
+    {
+        return *e_->value;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      cast to std::string. it makes other pystr functions available.
+     * @return     interned string.
+     */
+    operator const std::string&(void) const noexcept
+    {
+        return *e_->value;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      getter of entry of intern table.
+     * @return     entry of intern table.
+     */
+    const intern_detail::entry* get(void) const noexcept
+    {
+        return e_;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator==. compares only pointers.
+     * @param[in]  rhs: right hand side of operator==
+     * @return     result of operator==
+     */
+    bool operator==(const interned& rhs) const noexcept
+    {
+        return e_ == rhs.e_;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      operator!=. compares only pointers.
+     * @param[in]  rhs: right hand side of operator!=
+     * @return     result of operator!=
+     */
+    bool operator!=(const interned& rhs) const noexcept
+    {
+        return e_ != rhs.e_;
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    const intern_detail::entry* e_;
+    /////////////////////////////////////////////////////////////////////////////
+
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief intern a string.
+ *        pystr::intern("abc") <=> sys.intern('abc')
+ */
+interned intern(const std::string& self);
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.__eq__() with interned strings. it is a pointer comparison.
+ *        pystr::eq(intern("abc"), intern("a")) <=> 'abc' == 'a'
+ */
+inline bool eq(interned self, interned x) noexcept
+{
+    return self == x;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.__ne__() with interned strings. it is a pointer comparison.
+ *        pystr::ne(intern("abc"), intern("a")) <=> 'abc' != 'a'
+ */
+inline bool ne(interned self, interned x) noexcept
+{
+    return self != x;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.capitalize() with interned string. the result is cached.
+ *        pystr::capitalize(intern("abc")) <=> 'abc'.capitalize()
+ */
+interned capitalize(interned self);
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.casefold() with interned string. the result is cached.
+ *        pystr::casefold(intern("abc")) <=> 'abc'.casefold()
+ */
+interned casefold(interned self);
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.lower() with interned string. the result is cached.
+ *        pystr::lower(intern("abc")) <=> 'abc'.lower()
+ */
+interned lower(interned self);
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.lstrip() with interned string.
+ *        pystr::lstrip(intern("  abc")) <=> '  abc'.lstrip()
+ * @note  the result is cached only when chars is default.
+ */
+interned lstrip(interned self, const std::string& chars=std::string(" "));
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.rstrip() with interned string.
+ *        pystr::rstrip(intern("abc  ")) <=> 'abc  '.rstrip()
+ * @note  the result is cached only when chars is default.
+ */
+interned rstrip(interned self, const std::string& chars=std::string(" "));
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.strip() with interned string.
+ *        pystr::strip(intern(" abc ")) <=> ' abc '.strip()
+ * @note  the result is cached only when chars is default.
+ */
+interned strip(interned self, const std::string& chars=std::string(" "));
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.swapcase() with interned string. the result is cached.
+ *        pystr::swapcase(intern("abc")) <=> 'abc'.swapcase()
+ */
+interned swapcase(interned self);
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.title() with interned string. the result is cached.
+ *        pystr::title(intern("abc")) <=> 'abc'.title()
+ */
+interned title(interned self);
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.upper() with interned string. the result is cached.
+ *        pystr::upper(intern("abc")) <=> 'abc'.upper()
+ */
+interned upper(interned self);
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace pystr {
+} // namespace ken3 {
+
+namespace std {
+
+/**
+ * @brief   std::hash for ken3::pystr::interned. hashes only pointer.
+ */
+template <>
+struct hash<ken3::pystr::interned>
+{
+    std::size_t operator()(const ken3::pystr::interned& i) const noexcept
+    {
+        return std::hash<const ken3::pystr::intern_detail::entry*>()(i.get());
+    }
+};
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace std {
+
+#endif // #ifndef INCLUDE_GUARD_KEN3_PYSTR_INTERN_HPP
@@ -0,0 +1,427 @@
+/**
+ * @file    ken3/pystr/parallel.cpp
+ * @brief   Implementation of thread pool and parallel pystr functions.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more.
+ */
+
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include "ken3/pystr/parallel.hpp"
+
+namespace {
+
+using ken3::pystr::index_type;
+using ken3::pystr::None;
+
+/**
+ * @struct    range
+ * @brief     searched range [first, last) of string.
+ */
+struct range
+{
+    std::size_t first;
+    std::size_t last;
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct    chain
+ * @brief     result of counting in a chunk. exit is the position where
+ *            the next chunk starts searching.
+ */
+struct chain
+{
+    index_type count;
+    std::size_t exit;
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief     helper function to adjust start and end as Python does.
+ * @param[in] size: size of string
+ * @param[in] start: start index
+ * @param[in] end: end index
+ * @return    adjusted range. first may be greater than last.
+ */
+range adjust(std::size_t size, index_type start, index_type end)
+{
+    index_type len = static_cast<index_type>(size);
+
+    if ((end == None) || (end > len)) {
+        end = len;
+    }
+    else if (end < 0) {
+        end = std::max(end + len, static_cast<index_type>(0));
+    }
+
+    if (start == None) {
+        start = 0;
+    }
+    else if (start < 0) {
+        start = std::max(start + len, static_cast<index_type>(0));
+    }
+
+    return range{static_cast<std::size_t>(start), static_cast<std::size_t>(end)};
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief     helper function to search sub in data.
+ * @param[in] data: string data
+ * @param[in] first: first position where sub may start
+ * @param[in] last: the position after the last one where sub may start
+ * @param[in] limit: the position where sub must end before
+ * @param[in] sub: searched string, which is not empty
+ * @return    found position. std::string::npos if not found.
+ */
+std::size_t search(const char* data, std::size_t first, std::size_t last, std::size_t limit, const std::string& sub)
+{
+    std::size_t m = sub.size();
+    if (limit < m) {
+        return std::string::npos;
+    }
+    last = std::min(last, limit - m + 1);
+
+    while (first < last) {
+        const void* p = memchr(data + first, sub[0], last - first);
+        if (p == nullptr) {
+            break;
+        }
+        first = static_cast<std::size_t>(static_cast<const char*>(p) - data);
+        if (memcmp(data + first + 1, sub.data() + 1, m - 1) == 0) {
+            return first;
+        }
+        first++;
+    }
+    return std::string::npos;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief     helper function to count non-overlapping sub in a chunk.
+ * @param[in] data: string data
+ * @param[in] entry: position where counting starts
+ * @param[in] last: the position after the last one where sub may start
+ * @param[in] limit: the position where sub must end before
+ * @param[in] sub: searched string, which is not empty
+ * @return    count and exit position
+ */
+chain count_chain(const char* data, std::size_t entry, std::size_t last, std::size_t limit, const std::string& sub)
+{
+    chain c{0, entry};
+    for (;;) {
+        std::size_t pos = search(data, c.exit, last, limit, sub);
+        if (pos == std::string::npos) {
+            break;
+        }
+        c.count++;
+        c.exit = pos + sub.size();
+    }
+    return c;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief     helper function to count non-overlapping sub in a chunk which
+ *            is entered at entry instead of first. matches are compared with
+ *            the chain from first, and the rest of the chain is reused after
+ *            both chains reach the same match.
+ * @param[in] data: string data
+ * @param[in] first: the first position of chunk
+ * @param[in] entry: position where counting starts. first < entry
+ * @param[in] last: the position after the last one where sub may start
+ * @param[in] limit: the position where sub must end before
+ * @param[in] sub: searched string, which is not empty
+ * @param[in] base: result of count_chain() from first
+ * @return    count and exit position
+ */
+chain count_chain(const char* data, std::size_t first, std::size_t entry, std::size_t last, std::size_t limit,
+                  const std::string& sub, const chain& base)
+{
+    std::size_t m = sub.size();
+    std::size_t p = search(data, first, last, limit, sub);
+    std::size_t q = search(data, entry, last, limit, sub);
+    index_type cp = 0;
+    chain c{0, entry};
+    while (q != std::string::npos) {
+        if (p == q) {
+            return chain{c.count + base.count - cp, base.exit};
+        }
+        else if (p < q) {
+            cp++;
+            p = search(data, p + m, last, limit, sub);
+        }
+        else {
+            c.count++;
+            c.exit = q + m;
+            q = search(data, q + m, last, limit, sub);
+        }
+    }
+    return c;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief     helper function to divide range into chunks.
+ * @param[in] r: range of positions where sub may start. r.first < r.last
+ * @param[in] chunk_size: size of a chunk
+ * @return    first positions of chunks and r.last
+ */
+std::vector<std::size_t> divide(const range& r, std::size_t chunk_size)
+{
+    chunk_size = std::max(chunk_size, static_cast<std::size_t>(1));
+
+    std::vector<std::size_t> bounds;
+    for (std::size_t i = r.first; i < r.last; i += std::min(chunk_size, r.last - i)) {
+        bounds.push_back(i);
+    }
+    bounds.push_back(r.last);
+    return bounds;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace {
+
+namespace ken3 {
+namespace pystr {
+namespace parallel {
+
+/**
+ * @brief      constructor. threads are started.
+ * @param[in]  size: the number of worker threads.
+ */
+thread_pool::thread_pool(std::size_t size) :
+    threads_(),
+    queue_(),
+    mutex_(),
+    cond_(),
+    stop_(false)
+{
+    for (std::size_t i = 0; i < size; i++) {
+        threads_.emplace_back(&thread_pool::work, this);
+    }
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      destructor. threads are joined.
+ */
+thread_pool::~thread_pool(void) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cond_.notify_all();
+    for (auto& i: threads_) {
+        i.join();
+    }
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      call func(i) for each i in [0, n), and wait for all calls.
+ * @param[in]  n: the number of calls.
+ * @param[in]  func: called function.
+ * @throw      the first exception thrown by func.
+ */
+void thread_pool::parallel_for(std::size_t n, const std::function<void(std::size_t)>& func)
+{
+    // shared state. workers may refer to it after this function returns.
+    struct state
+    {
+        std::function<void(std::size_t)> func;
+        std::size_t n;
+        std::atomic<std::size_t> next;
+        std::size_t done;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable cond;
+    };
+    std::shared_ptr<state> s = std::make_shared<state>();
+    s->func = func;
+    s->n = n;
+    s->next = 0;
+    s->done = 0;
+
+    auto task = [s] {
+        for (;;) {
+            std::size_t i = s->next.fetch_add(1);
+            if (i >= s->n) {
+                break;
+            }
+            std::exception_ptr error;
+            try {
+                s->func(i);
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(s->mutex);
+            if (error && !s->error) {
+                s->error = error;
+            }
+            if (++s->done == s->n) {
+                s->cond.notify_all();
+            }
+        }
+    };
+
+    // the calling thread also runs the task, so no deadlock occurs
+    // even if all workers are busy
+    std::size_t helpers = std::min(size(), (n == 0) ? 0 : n - 1);
+    if (helpers != 0) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (std::size_t i = 0; i < helpers; i++) {
+                queue_.push_back(task);
+            }
+        }
+        cond_.notify_all();
+    }
+    task();
+
+    std::unique_lock<std::mutex> lock(s->mutex);
+    s->cond.wait(lock, [&s] { return s->done == s->n; });
+    if (s->error) {
+        std::rethrow_exception(s->error);
+    }
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      main loop of worker threads.
+ */
+void thread_pool::work(void)
+{
+    for (;;) {
+        std::function<void(void)> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cond_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;
+            }
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        task();
+    }
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      getter of thread pool which is used by default.
+ *             its size is std::thread::hardware_concurrency() - 1.
+ * @return     default thread pool.
+ */
+thread_pool& default_pool(void)
+{
+    static thread_pool pool(std::max(std::thread::hardware_concurrency(), 1U) - 1);
+    return pool;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.count() with thread pool
+ *        pystr::parallel::count("abc", "a") <=> 'abc'.count('a')
+ */
+index_type count(const std::string& self, const std::string& sub, index_type start/*=None*/, index_type end/*=None*/,
+                 thread_pool& pool/*=default_pool()*/, std::size_t chunk_size/*=default_chunk_size*/)
+{
+    range r = adjust(self.size(), start, end);
+    if ((r.first > r.last) || (r.last - r.first < sub.size())) {
+        return 0;
+    }
+    if (sub.empty()) {
+        return static_cast<index_type>(r.last - r.first + 1);
+    }
+
+    const char* data = self.data();
+    std::size_t m = sub.size();
+    std::vector<std::size_t> bounds = divide(range{r.first, r.last - m + 1}, chunk_size);
+    std::size_t n = bounds.size() - 1;
+    if (n == 1) {
+        return count_chain(data, r.first, bounds[1], r.last, sub).count;
+    }
+
+    // each chunk is counted from its first position in parallel
+    std::vector<chain> results(n);
+    pool.parallel_for(n, [&](std::size_t i) {
+        results[i] = count_chain(data, bounds[i], bounds[i + 1], r.last, sub);
+    });
+
+    // connect chunks in order. if a match spans the boundary, the chunk is
+    // counted again from its end until the chain meets the parallel one.
+    // it is done once per boundary, thus periodic sub (ex. "aaa") costs at
+    // most twice as much as the serial count.
+    index_type counter = 0;
+    std::size_t entry = r.first;
+    for (std::size_t i = 0; i < n; i++) {
+        const chain c = (entry > bounds[i]) ?
+            count_chain(data, bounds[i], entry, bounds[i + 1], r.last, sub, results[i]) : results[i];
+        counter += c.count;
+        entry = c.exit;
+    }
+    return counter;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.find() with thread pool
+ *        pystr::parallel::find("abc", "a") <=> 'abc'.find('a')
+ */
+index_type find(const std::string& self, const std::string& sub, index_type start/*=None*/, index_type end/*=None*/,
+                thread_pool& pool/*=default_pool()*/, std::size_t chunk_size/*=default_chunk_size*/)
+{
+    range r = adjust(self.size(), start, end);
+    if ((r.first > r.last) || (r.last - r.first < sub.size())) {
+        return -1;
+    }
+    if (sub.empty()) {
+        return static_cast<index_type>(r.first);
+    }
+
+    const char* data = self.data();
+    std::vector<std::size_t> bounds = divide(range{r.first, r.last - sub.size() + 1}, chunk_size);
+    std::size_t n = bounds.size() - 1;
+
+    // chunks after the found one are skipped
+    std::vector<std::size_t> found(n, std::string::npos);
+    std::atomic<std::size_t> found_chunk(n);
+    auto func = [&](std::size_t i) {
+        if (i > found_chunk.load()) {
+            return;
+        }
+        found[i] = search(data, bounds[i], bounds[i + 1], r.last, sub);
+        if (found[i] != std::string::npos) {
+            std::size_t current = found_chunk.load();
+            while ((i < current) && !found_chunk.compare_exchange_weak(current, i)) {
+            }
+        }
+    };
+    if (n == 1) {
+        func(0);
+    }
+    else {
+        pool.parallel_for(n, func);
+    }
+
+    for (const auto& i: found) {
+        if (i != std::string::npos) {
+            return static_cast<index_type>(i);
+        }
+    }
+    return -1;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace parallel {
+} // namespace pystr {
+} // namespace ken3 {
@@ -0,0 +1,142 @@
+/**
+ * @file    ken3/pystr/parallel.hpp
+ * @brief   Define thread pool and parallel versions of pystr functions.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more.
+ *
+ * @note
+ * ken3::pystr::parallel::count() and ken3::pystr::parallel::find() return
+ * the same results as str.count() and str.find() in Python, including
+ * start and end arguments. e.g.)
+ *     ken3::pystr::parallel::count("aaaa", "aa") => 2
+ *     ken3::pystr::parallel::find("abc", "", 5) => -1
+ *
+ * The searched range is divided into chunks of chunk_size bytes, and each
+ * chunk is searched by thread_pool. A needle which spans chunk boundaries
+ * is handled correctly. If the range is not longer than chunk_size, it is
+ * searched in the calling thread.
+ */
+
+#ifndef INCLUDE_GUARD_KEN3_PYSTR_PARALLEL_HPP
+#define INCLUDE_GUARD_KEN3_PYSTR_PARALLEL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ken3/pystr.hpp"
+
+namespace ken3 {
+namespace pystr {
+namespace parallel {
+
+/**
+ * @class   thread_pool
+ * @brief   fixed size thread pool. the calling thread of parallel_for()
+ *          also runs tasks, so a pool whose size is 0 runs all tasks in
+ *          the calling thread.
+ */
+class thread_pool
+{
+public:
+    /**
+     * @brief      constructor. threads are started.
+     * @param[in]  size: the number of worker threads.
+     */
+    explicit thread_pool(std::size_t size);
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      destructor. threads are joined.
+     */
+    ~thread_pool(void) noexcept;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      thread_pool is neither copyable nor movable.
+     */
+    thread_pool(void) = delete;
+    thread_pool(const thread_pool& src) = delete;
+    thread_pool(thread_pool&& src) = delete;
+    thread_pool& operator=(const thread_pool& rhs) = delete;
+    thread_pool& operator=(thread_pool&& rhs) = delete;
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      getter of the number of worker threads.
+     * @return     the number of worker threads.
+     */
+    std::size_t size(void) const noexcept
+    {
+        return threads_.size();
+    }
+    /////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief      call func(i) for each i in [0, n), and wait for all calls.
+     * @param[in]  n: the number of calls.
+     * @param[in]  func: called function.
+     * @throw      the first exception thrown by func.
+     */
+    void parallel_for(std::size_t n, const std::function<void(std::size_t)>& func);
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    /**
+     * @brief      main loop of worker threads.
+     */
+    void work(void);
+    /////////////////////////////////////////////////////////////////////////////
+
+private:
+    std::vector<std::thread> threads_;
+    std::deque<std::function<void(void)>> queue_;
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    bool stop_;
+    /////////////////////////////////////////////////////////////////////////////
+
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      getter of thread pool which is used by default.
+ *             its size is std::thread::hardware_concurrency() - 1.
+ * @return     default thread pool.
+ */
+thread_pool& default_pool(void);
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      default size of chunk in bytes.
+ */
+const std::size_t default_chunk_size = 1 << 20;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.count() with thread pool
+ *        pystr::parallel::count("abc", "a") <=> 'abc'.count('a')
+ */
+index_type count(const std::string& self, const std::string& sub, index_type start=None, index_type end=None,
+                 thread_pool& pool=default_pool(), std::size_t chunk_size=default_chunk_size);
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief str.find() with thread pool
+ *        pystr::parallel::find("abc", "a") <=> 'abc'.find('a')
+ */
+index_type find(const std::string& self, const std::string& sub, index_type start=None, index_type end=None,
+                thread_pool& pool=default_pool(), std::size_t chunk_size=default_chunk_size);
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace parallel {
+} // namespace pystr {
+} // namespace ken3 {
+
+#endif // #ifndef INCLUDE_GUARD_KEN3_PYSTR_PARALLEL_HPP
@@ -0,0 +1,106 @@
+/**
+ * @file    unittest/biconv/static_test.cpp
+ * @brief   Testing ken3::static_biconv using lest.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ */
+
+#include <stdexcept>
+#include "ken3/biconv/static.hpp"
+#include "unittest/lest.hpp"
+
+namespace {
+
+enum class color
+{
+    red,
+    green,
+    blue,
+    white,
+};
+
+constexpr ken3::static_biconv<char, int, 4> abc{{{'C', 12}, {'A', 10}, {'D', 9}, {'B', 11}}};
+
+constexpr ken3::static_biconv<color, unsigned, 4> colors{{
+    {color::white, 0xffffffU}, {color::red, 0xff0000U}, {color::green, 0x00ff00U}, {color::blue, 0x0000ffU},
+}};
+
+constexpr ken3::static_biconv<int, int, 20> codes{{
+    {404, 7}, {200, 1}, {500, 9}, {301, 4}, {201, 2}, {302, 5}, {400, 6}, {204, 3}, {503, 11}, {502, 10},
+    {100, 0}, {401, 12}, {403, 13}, {405, 14}, {409, 15}, {410, 16}, {429, 17}, {501, 18}, {504, 19}, {303, 20},
+}};
+
+// constant arguments are converted at compile time
+static_assert(abc.convert('A') == 10, "convert() is constexpr");
+static_assert(abc.rconvert(9) == 'D', "rconvert() is constexpr");
+static_assert(abc.containF('B') && !abc.containF('E'), "containF() is constexpr");
+static_assert(abc.containS(12) && !abc.containS(13), "containS() is constexpr");
+static_assert(abc.convert('E', -1) == -1, "convert() with default is constexpr");
+static_assert(colors.rconvert(0x00ff00U) == color::green, "enum is available");
+static_assert(codes.convert(503) == 11, "large table is available");
+
+} // namespace {
+
+const lest::test specification[] =
+{
+
+    CASE("convert() and rconvert() with runtime values")
+    {
+        volatile char f = 'C';
+        volatile int s = 11;
+
+        EXPECT(4UL == abc.size());
+        EXPECT(12 == abc.convert(static_cast<char>(f)));
+        EXPECT('B' == abc.rconvert(static_cast<int>(s)));
+        EXPECT(0 == abc.convert('E', 0));
+        EXPECT('\0' == abc.rconvert(13, '\0'));
+        EXPECT_THROWS_AS(abc.convert('E'), std::out_of_range);
+        EXPECT_THROWS_AS(abc.rconvert(13), std::out_of_range);
+    },
+
+    CASE("all pairs of large table")
+    {
+        const int keys[] = {100, 200, 201, 204, 301, 302, 303, 400, 401, 403, 404, 405, 409, 410, 429, 500, 501, 502, 503, 504};
+
+        for (const auto& k: keys) {
+            EXPECT(codes.containF(k));
+            EXPECT(k == codes.rconvert(codes.convert(k)));
+        }
+        for (int k = 0; k < 600; k++) {
+            if (codes.containF(k)) {
+                EXPECT(codes.containS(codes.convert(k)));
+            }
+        }
+        EXPECT(not codes.containF(402));
+        EXPECT(not codes.containS(8));
+        EXPECT(not codes.containS(21));
+    },
+
+    CASE("duplex element is found as first one")
+    {
+        constexpr ken3::static_biconv<char, int, 4> bc{{{'B', 2}, {'A', 1}, {'B', 3}, {'C', 1}}};
+
+        EXPECT(2 == bc.convert('B'));
+        EXPECT('A' == bc.rconvert(1));
+        EXPECT('B' == bc.rconvert(3));
+    },
+
+    CASE("not constexpr object")
+    {
+        int base = 5;
+        ken3::static_biconv<int, int, 3> bc{{{base, 50}, {base + 2, 70}, {base - 1, 40}}};
+
+        EXPECT(70 == bc.convert(7));
+        EXPECT(4 == bc.rconvert(40));
+        EXPECT(not bc.containF(6));
+    },
+
+};
+
+int main(int argc, char* argv[])
+{
+    return lest::run(specification, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
@@ -7,9 +7,44 @@
  * @remark  the target is C++11 or more
  */
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 #include "ken3/biconv.hpp"
 #include "unittest/lest.hpp"
 
+namespace {
+
+/**
+ * @struct  serial_pool
+ * @brief   thread pool for convert_many(), which runs all chunks in the calling thread.
+ */
+struct serial_pool
+{
+    std::size_t size(void) const
+    {
+        return 3;
+    }
+
+    void parallel_for(std::size_t n, const std::function<void(std::size_t)>& func)
+    {
+        calls = n;
+        for (std::size_t i = 0; i < n; i++) {
+            func(i);
+        }
+    }
+
+    std::size_t calls = 0;
+};
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace {
+
 const lest::test specification[] =
 {
 
@@ -89,6 +124,140 @@ const lest::test specification[] =
         EXPECT(false == bc.containS(10));
     },
 
+    CASE("hashed type with small datasets")
+    {
+        ken3::biconv<char, int, ken3::biconv_type::hashed> bc{{'A', 10}, {'B', 11}, {'C', 12}, {'A', 13}};
+
+        EXPECT(10 == bc.convert('A'));
+        EXPECT('C' == bc.rconvert(12));
+        EXPECT('A' == bc.rconvert(13));
+        EXPECT_THROWS_AS(bc.convert('D'), std::out_of_range);
+        EXPECT(0 == bc.convert('D', 0));
+        EXPECT(false == bc.containS(14));
+    },
+
+    CASE("hashed type with large datasets")
+    {
+        using my_conv = ken3::biconv<int, std::string, ken3::biconv_type::hashed>;
+
+        my_conv bc{
+            {0, "0"}, {1, "1"}, {2, "2"}, {3, "3"}, {4, "4"}, {5, "5"}, {6, "6"}, {7, "7"},
+            {8, "8"}, {9, "9"}, {10, "10"}, {11, "11"}, {12, "12"}, {13, "13"}, {14, "14"}, {15, "15"},
+            {16, "16"}, {17, "17"}, {0, "18"}, {19, "1"},
+        };
+
+        for (int i = 0; i < 18; i++) {
+            EXPECT(std::to_string(i) == bc.convert(i));
+            EXPECT(i == bc.rconvert(std::to_string(i)));
+        }
+        // the first one is found if element is duplex, as same as linear type
+        EXPECT(0 == bc.rconvert("18"));
+        EXPECT("0" == bc.convert(0));
+        EXPECT(1 == bc.rconvert("1"));
+        EXPECT(true == bc.containF(19));
+        EXPECT(false == bc.containS("19"));
+        EXPECT_THROWS_AS(bc.convert(20), std::out_of_range);
+        EXPECT_THROWS_AS(bc.rconvert("20"), std::out_of_range);
+        EXPECT(-1 == bc.rconvert("20", -1));
+
+        my_conv copied(bc);
+        EXPECT("17" == copied.convert(17));
+        EXPECT(17 == copied.rconvert("17"));
+    },
+
+    CASE("column search of integral, enum, and pointer")
+    {
+        enum class code { a, b, c, d };
+        static const char text[] = "abcd";
+
+        std::vector<std::pair<int, long>> v;
+        for (int i = 0; i < 40; i++) {
+            v.emplace_back(i * 3, -i);
+        }
+        v.emplace_back(33, 100);
+        ken3::biconv<int, long> bc(v.begin(), v.end());
+        for (int i = 0; i < 40; i++) {
+            EXPECT(-i == bc.convert(i * 3));
+            EXPECT(i * 3 == bc.rconvert(-i));
+        }
+        // the duplex element is after the first block of SSE2
+        EXPECT(-11 == bc.convert(33));
+        EXPECT(33 == bc.rconvert(100));
+        EXPECT(false == bc.containF(1));
+        EXPECT(false == bc.containS(1));
+
+        ken3::biconv<code, const char*> cc{{code::a, text}, {code::b, text + 1}, {code::c, text + 2}};
+        EXPECT(text + 1 == cc.convert(code::b));
+        EXPECT(code::c == cc.rconvert(text + 2));
+        EXPECT(false == cc.containF(code::d));
+
+        ken3::biconv<bool, int> bb{{true, 1}, {false, 0}};
+        EXPECT(0 == bb.convert(false));
+    },
+
+    CASE("convert_many() and rconvert_many()")
+    {
+        ken3::biconv<char, int> bc{{'A', 10}, {'B', 11}, {'C', 12}};
+        const std::vector<char> fs{'C', 'A', 'X', 'B'};
+        const std::vector<int> ss{11, 13, 10};
+
+        std::vector<int> converted;
+        bc.convert_many(fs.begin(), fs.end(), std::back_inserter(converted), -1);
+        EXPECT((std::vector<int>{12, 10, -1, 11}) == converted);
+        std::vector<char> rconverted(ss.size());
+        auto last = bc.rconvert_many(ss.begin(), ss.end(), rconverted.begin(), '?');
+        EXPECT(rconverted.end() == last);
+        EXPECT((std::vector<char>{'B', '?', 'A'}) == rconverted);
+
+        converted.clear();
+        EXPECT_THROWS_AS(bc.convert_many(fs.begin(), fs.end(), std::back_inserter(converted)), std::out_of_range);
+        EXPECT((std::vector<int>{12, 10}) == converted);
+        rconverted.assign(2, '\0');
+        bc.rconvert_many(ss.begin() + 2, ss.end(), rconverted.begin());
+        EXPECT('A' == rconverted[0]);
+
+        // a large batch is converted by sorted column, and duplex elements
+        // are converted as same as convert().
+        std::vector<std::pair<int, int>> pairs;
+        for (int i = 0; i < 1000; i++) {
+            pairs.emplace_back((i * 7) % 500, 1000 - i);
+        }
+        ken3::biconv<int, int> large(pairs.begin(), pairs.end());
+        std::vector<int> keys;
+        for (int i = 0; i < 2000; i++) {
+            keys.push_back((i * 13) % 1200);
+        }
+        converted.clear();
+        large.convert_many(keys.begin(), keys.end(), std::back_inserter(converted), -1);
+        std::vector<int> expected;
+        for (auto i: keys) {
+            expected.push_back(large.convert(i, -1));
+        }
+        EXPECT(expected == converted);
+        converted.clear();
+        EXPECT_THROWS_AS(large.convert_many(keys.begin(), keys.end(), std::back_inserter(converted)), std::out_of_range);
+        EXPECT(std::vector<int>(expected.begin(), std::find(expected.begin(), expected.end(), -1)) == converted);
+        std::vector<int> rconverted2(keys.size());
+        large.rconvert_many(expected.begin(), expected.end(), rconverted2.begin(), -1);
+        for (std::size_t i = 0; i < keys.size(); i++) {
+            EXPECT(large.rconvert(expected[i], -1) == rconverted2[i]);
+        }
+
+        serial_pool pool;
+        std::vector<int> many(40000, 35);
+        many[1] = 999;
+        converted.assign(many.size(), 0);
+        EXPECT(converted.end() == large.convert_many(pool, many.begin(), many.end(), converted.begin(), -1));
+        EXPECT(2UL == pool.calls);
+        EXPECT(large.convert(35) == converted[0]);
+        EXPECT(-1 == converted[1]);
+        EXPECT(large.convert(35) == converted.back());
+        rconverted.assign(ss.size(), '\0');
+        bc.rconvert_many(pool, ss.begin(), ss.end(), rconverted.begin(), '?');
+        EXPECT(1UL == pool.calls);
+        EXPECT((std::vector<char>{'B', '?', 'A'}) == rconverted);
+    },
+
 };
 
 int main(int argc, char* argv[])
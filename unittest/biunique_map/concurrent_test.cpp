@@ -0,0 +1,245 @@
+/**
+ * @file    unittest/biunique_map/concurrent_test.cpp
+ * @brief   Testing ken3::concurrent_biunique_map using lest.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ */
+
+#include <atomic>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "ken3/biunique_map/concurrent.hpp"
+#include "unittest/lest.hpp"
+
+namespace {
+
+int copies = 0;                                             // number of copies
+int countdown = 0;                                          // copy to throw, 0: never
+
+/**
+ * @brief   value whose copy throws once at the given count.
+ */
+struct fragile
+{
+    int value;
+
+    fragile(int v) : value(v) {}
+
+    fragile(const fragile& x) : value(x.value)
+    {
+        copies++;
+        if (0 < countdown && --countdown == 0) {
+            throw std::runtime_error("fragile");
+        }
+    }
+
+    fragile& operator=(const fragile& x) = default;
+
+    bool operator<(const fragile& x) const
+    {
+        return value < x.value;
+    }
+
+    bool operator==(const fragile& x) const
+    {
+        return value == x.value;
+    }
+};
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace {
+
+const lest::test specification[] =
+{
+
+    CASE("functions with silence policy")
+    {
+        using my_map = ken3::concurrent_biunique_map<char, int>;
+
+        my_map bm{{'A', 10}, {'B', 11}, {'C', 11}};
+        EXPECT(2UL == bm.size());
+        EXPECT(10 == bm.f2s('A'));
+        EXPECT('B' == bm.s2f(11));
+        EXPECT(bm.has_f('A'));
+        EXPECT(not bm.has_s(12));
+        EXPECT_THROWS_AS(bm.f2s('C'), std::out_of_range);
+
+        bm.insert('C', 12);
+        bm.insert('D', 12);
+        EXPECT('C' == bm.s2f(12));
+        bm.insert({{'D', 13}, {'E', 13}});
+        EXPECT('D' == bm.s2f(13));
+        std::vector<std::pair<char, int>> v{{'F', 15}, {'G', 16}};
+        bm.insert(v.begin(), v.end());
+        EXPECT(6UL == bm.size());
+
+        bm.erase_by_f('A');
+        bm.erase_by_s(11);
+        EXPECT(not bm.has_f('A'));
+        EXPECT(not bm.has_f('B'));
+        EXPECT(4UL == bm.size());
+
+        my_map::map_type snapshot = bm.snapshot();
+        bm.clear();
+        EXPECT(bm.empty());
+        EXPECT(4UL == snapshot.size());
+        bm.assign(snapshot);
+        EXPECT(16 == bm.f2s('G'));
+        EXPECT(4UL == bm.size());
+    },
+
+    CASE("functions with throwing policy")
+    {
+        using my_map = ken3::concurrent_biunique_map<char, int, ken3::biunique_map_type::unordered_no_default,
+                                                     ken3::biunique_map_policy::throwing>;
+
+        EXPECT_THROWS_AS(my_map({{'A', 10}, {'A', 11}}), std::invalid_argument);
+        my_map bm{{'A', 10}};
+        EXPECT_THROWS_AS(bm.insert('A', 11), std::invalid_argument);
+        EXPECT_THROWS_AS(bm.insert({{'B', 11}, {'C', 10}}), std::invalid_argument);
+        EXPECT(1UL == bm.size());
+        EXPECT(not bm.has_f('B'));
+        bm.insert({{'B', 11}, {'C', 12}});
+        EXPECT(3UL == bm.size());
+        EXPECT('C' == bm.s2f(12));
+
+        // both instances are still same after failed inserts
+        for (int i = 0; i < 4; i++) {
+            bm.insert(static_cast<char>('D' + i), 13 + i);
+        }
+        EXPECT(7UL == bm.size());
+        EXPECT('G' == bm.s2f(16));
+    },
+
+    CASE("f2s_many() and s2f_many()")
+    {
+        using my_map = ken3::concurrent_biunique_map<char, int>;
+
+        my_map bm{{'A', 10}, {'B', 11}, {'C', 12}};
+        const std::vector<char> fs{'C', 'X', 'A'};
+        const std::vector<int> ss{12, 11};
+        std::vector<int> converted;
+        bm.f2s_many(fs.begin(), fs.end(), std::back_inserter(converted), -1);
+        EXPECT((std::vector<int>{12, -1, 10}) == converted);
+        EXPECT_THROWS_AS(bm.f2s_many(fs.begin(), fs.end(), converted.begin()), std::out_of_range);
+        std::vector<char> rconverted;
+        bm.s2f_many(ss.begin(), ss.end(), std::back_inserter(rconverted));
+        EXPECT((std::vector<char>{'C', 'B'}) == rconverted);
+        rconverted.clear();
+        bm.s2f_many(ss.begin(), ss.end(), std::back_inserter(rconverted), '?');
+        EXPECT(2UL == rconverted.size());
+
+        // a writer can insert after an exception in batch
+        bm.insert('D', 13);
+        EXPECT(13 == bm.f2s('D'));
+    },
+
+    CASE("failure in the second modification")
+    {
+        using my_map = ken3::concurrent_biunique_map<char, fragile>;
+
+        my_map::map_type m{{'A', fragile(10)}, {'B', fragile(11)}};
+
+        // count copies of the first modification
+        my_map counted{{'C', fragile(12)}};
+        copies = 0;
+        counted.assign(m);
+        const int first = copies / 2;
+
+        // the second modification throws at its first copy
+        my_map bm{{'C', fragile(12)}};
+        countdown = first + 1;
+        bm.assign(m);
+        EXPECT(0 == countdown);
+        EXPECT(2UL == bm.size());
+        EXPECT(not bm.has_f('C'));
+
+        // the next write starts from the assigned contents
+        bm.insert('D', fragile(13));
+        EXPECT(3UL == bm.size());
+        EXPECT(bm.has_f('A'));
+        EXPECT(bm.has_f('B'));
+        EXPECT(not bm.has_f('C'));
+        EXPECT(bm.has_f('D'));
+        bm.insert('E', fragile(14));
+        EXPECT(4UL == bm.size());
+        EXPECT(not bm.has_f('C'));
+    },
+
+    CASE("readers and writer in multi threads")
+    {
+        using my_map = ken3::concurrent_biunique_map<int, std::string>;
+
+        const int key_size = 100;
+        my_map bm;
+        for (int i = 0; i < key_size; i += 2) {
+            bm.insert(i, std::to_string(i * 10));
+        }
+
+        std::atomic<bool> stop(false);
+        std::atomic<int> errors(0);
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; t++) {
+            readers.emplace_back([&bm, &stop, &errors] {
+                int k = 0;
+                while (!stop.load()) {
+                    // a key is always connected to 10 times of itself
+                    try {
+                        if (bm.f2s(k) != std::to_string(k * 10)) {
+                            errors++;
+                        }
+                    }
+                    catch (const std::out_of_range&) {
+                    }
+                    try {
+                        if (bm.s2f(std::to_string(k * 10)) != k) {
+                            errors++;
+                        }
+                    }
+                    catch (const std::out_of_range&) {
+                    }
+                    my_map::map_type m = bm.snapshot();
+                    for (auto i = m.cbegin(); i != m.cend(); ++i) {
+                        if (i->second != std::to_string(i->first * 10)) {
+                            errors++;
+                        }
+                    }
+                    k = (k + 1) % key_size;
+                }
+            });
+        }
+
+        // each key is toggled 20 times, thus the map returns to the first state
+        for (int loop = 0; loop < 2000; loop++) {
+            int k = loop % key_size;
+            if (bm.has_f(k)) {
+                bm.erase_by_f(k);
+            }
+            else {
+                bm.insert(k, std::to_string(k * 10));
+            }
+        }
+        stop = true;
+        for (auto& i: readers) {
+            i.join();
+        }
+
+        EXPECT(0 == errors.load());
+        EXPECT(static_cast<std::size_t>(key_size / 2) == bm.size());
+        EXPECT(bm.has_f(0));
+        EXPECT(not bm.has_f(1));
+    },
+
+};
+
+int main(int argc, char* argv[])
+{
+    return lest::run(specification, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
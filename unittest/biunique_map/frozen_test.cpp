@@ -0,0 +1,161 @@
+/**
+ * @file    unittest/biunique_map/frozen_test.cpp
+ * @brief   Testing ken3::frozen_biunique_map using lest.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "ken3/biunique_map/frozen.hpp"
+#include "unittest/lest.hpp"
+
+namespace {
+
+/**
+ * @struct  bad_hash
+ * @brief   hash functor, which returns the same value for all arguments.
+ */
+struct bad_hash
+{
+    std::size_t operator()(int) const
+    {
+        return 0;
+    }
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct  point
+ * @brief   key type, which has no specialization of std::hash.
+ */
+struct point
+{
+    int x;
+    int y;
+
+    bool operator==(const point& rhs) const
+    {
+        return (x == rhs.x) && (y == rhs.y);
+    }
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct  point_hash
+ * @brief   hash functor of point.
+ */
+struct point_hash
+{
+    std::size_t operator()(const point& p) const
+    {
+        return std::hash<int>()(p.x) * 31 + std::hash<int>()(p.y);
+    }
+};
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace {
+
+const lest::test specification[] =
+{
+
+    CASE("functions with silence policy")
+    {
+        using my_map = ken3::frozen_biunique_map<char, std::string>;
+
+        const my_map bm{{'A', "a"}, {'B', "b"}, {'C', "b"}, {'B', "c"}, {'D', "d"}};
+        EXPECT(3UL == bm.size());
+        EXPECT(not bm.empty());
+        EXPECT("a" == bm.f2s('A'));
+        EXPECT("b" == bm.f2s('B'));
+        EXPECT('D' == bm.s2f("d"));
+        EXPECT(bm.has_f('A'));
+        EXPECT(not bm.has_f('C'));
+        EXPECT(bm.has_s("b"));
+        EXPECT(not bm.has_s("c"));
+        EXPECT_THROWS_AS(bm.f2s('C'), std::out_of_range);
+        EXPECT_THROWS_AS(bm.s2f("c"), std::out_of_range);
+
+        std::size_t count = 0;
+        for (auto i = bm.cbegin(); i != bm.cend(); ++i) {
+            EXPECT(i->second == bm.f2s(i->first));
+            count++;
+        }
+        EXPECT(3UL == count);
+
+        const my_map empty_map;
+        EXPECT(empty_map.empty());
+        EXPECT(not empty_map.has_f('A'));
+        EXPECT_THROWS_AS(empty_map.s2f("a"), std::out_of_range);
+    },
+
+    CASE("functions with throwing policy")
+    {
+        using my_map = ken3::frozen_biunique_map<char, int, ken3::biunique_map_policy::throwing>;
+
+        EXPECT_THROWS_AS(my_map({{'A', 10}, {'A', 11}}), std::invalid_argument);
+        EXPECT_THROWS_AS(my_map({{'A', 10}, {'B', 10}}), std::invalid_argument);
+        const my_map bm{{'A', 10}, {'B', 11}};
+        EXPECT('B' == bm.s2f(11));
+    },
+
+    CASE("many items")
+    {
+        using my_map = ken3::frozen_biunique_map<std::int64_t, std::string>;
+
+        std::vector<std::pair<std::int64_t, std::string>> v;
+        for (std::int64_t i = 0; i < 10000; i++) {
+            v.emplace_back(i * 7919, std::to_string(i));
+        }
+        const my_map bm(v.begin(), v.end());
+        EXPECT(v.size() == bm.size());
+        bool all_found = true;
+        for (const auto& i: v) {
+            all_found = all_found && (bm.f2s(i.first) == i.second) && (bm.s2f(i.second) == i.first);
+        }
+        EXPECT(all_found);
+        EXPECT(not bm.has_f(1));
+        EXPECT(not bm.has_s("-1"));
+    },
+
+    CASE("same hash values")
+    {
+        using my_map = ken3::frozen_biunique_map<int, int, ken3::biunique_map_policy::silence, bad_hash>;
+
+        EXPECT_THROWS_AS(my_map({{1, 10}, {2, 11}}), std::invalid_argument);
+        const my_map bm{{1, 10}};
+        EXPECT(10 == bm.f2s(1));
+        EXPECT(not bm.has_f(2));
+    },
+
+    CASE("key type without std::hash")
+    {
+        using my_map = ken3::frozen_biunique_map<point, int, ken3::biunique_map_policy::silence, point_hash>;
+
+        const my_map bm{{{1, 2}, 10}, {{2, 1}, 11}, {{1, 2}, 12}, {{3, 3}, 11}};
+        EXPECT(2UL == bm.size());
+        EXPECT(10 == bm.f2s(point{1, 2}));
+        EXPECT(11 == bm.f2s(point{2, 1}));
+        EXPECT(not bm.has_f(point{3, 3}));
+        EXPECT(not bm.has_s(12));
+        EXPECT((point{2, 1}) == bm.s2f(11));
+
+        using throwing_map = ken3::frozen_biunique_map<point, int, ken3::biunique_map_policy::throwing, point_hash>;
+        EXPECT_THROWS_AS(throwing_map({{{1, 2}, 10}, {{1, 2}, 11}}), std::invalid_argument);
+        EXPECT(1UL == throwing_map({{{1, 2}, 10}}).size());
+    },
+
+};
+
+int main(int argc, char* argv[])
+{
+    return lest::run(specification, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
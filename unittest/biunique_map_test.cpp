@@ -7,8 +7,14 @@
  * @remark  the target is C++11 or more
  */
 
+#include <cstddef>
+#include <functional>
 #include <iterator>
+#include <new>
+#include <stdexcept>
+#include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 #include "ken3/biunique_map.hpp"
 #include "unittest/lest.hpp"
@@ -27,7 +33,9 @@ using map_list = std::tuple<
     tmp_map<ken3::biunique_map_type::ordered_no_default,    ken3::biunique_map_policy::throwing>,
     tmp_map<ken3::biunique_map_type::ordered_front_default, ken3::biunique_map_policy::throwing>,
     tmp_map<ken3::biunique_map_type::ordered_back_default,  ken3::biunique_map_policy::throwing>,
-    tmp_map<ken3::biunique_map_type::unordered_no_default,  ken3::biunique_map_policy::throwing>
+    tmp_map<ken3::biunique_map_type::unordered_no_default,  ken3::biunique_map_policy::throwing>,
+    tmp_map<ken3::biunique_map_type::flat_no_default,       ken3::biunique_map_policy::silence>,
+    tmp_map<ken3::biunique_map_type::flat_no_default,       ken3::biunique_map_policy::throwing>
 >;
 /////////////////////////////////////////////////////////////////////////////
 
@@ -57,6 +65,149 @@ bool same_map(const MAP& lhs, const typename MAP::map_type& rhs)
 }
 /////////////////////////////////////////////////////////////////////////////
 
+/**
+ * @struct  alloc_counter
+ * @brief   counter of counting_allocator.
+ */
+struct alloc_counter
+{
+    std::size_t allocs = 0; // the number of allocate() calls
+    std::size_t live = 0;   // allocated bytes, which are not deallocated yet
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct  counting_allocator
+ * @brief   stateful allocator, which counts allocations in alloc_counter.
+ */
+template <typename T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    explicit counting_allocator(alloc_counter* c = nullptr) noexcept :
+        counter(c)
+    {
+    }
+
+    template <typename U>
+    counting_allocator(const counting_allocator<U>& src) noexcept :
+        counter(src.counter)
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if (counter != nullptr) {
+            counter->allocs++;
+            counter->live += n * sizeof(T);
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        if (counter != nullptr) {
+            counter->live -= n * sizeof(T);
+        }
+        ::operator delete(p);
+    }
+
+    alloc_counter* counter;
+};
+/////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename U>
+bool operator==(const counting_allocator<T>& lhs, const counting_allocator<U>& rhs)
+{
+    return lhs.counter == rhs.counter;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename U>
+bool operator!=(const counting_allocator<T>& lhs, const counting_allocator<U>& rhs)
+{
+    return lhs.counter != rhs.counter;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+template <ken3::biunique_map_type TYPE, ken3::biunique_map_policy POLICY>
+using alloc_map = ken3::biunique_map<char, int, TYPE, POLICY, counting_allocator<std::pair<const char, int>>>;
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct  serial_pool
+ * @brief   thread pool for f2s_many(), which runs all chunks in the calling thread.
+ */
+struct serial_pool
+{
+    std::size_t size(void) const
+    {
+        return 3;
+    }
+
+    void parallel_for(std::size_t n, const std::function<void(std::size_t)>& func)
+    {
+        calls = n;
+        for (std::size_t i = 0; i < n; i++) {
+            func(i);
+        }
+    }
+
+    std::size_t calls = 0;
+};
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      check f2s_many() and s2f_many() are same as f2s() and s2f() for
+ *             a large batch, which has duplex and not registered values.
+ * @tparam     TYPE: type of biunique_map.
+ * @return     true: same, false: not same.
+ */
+template <ken3::biunique_map_type TYPE>
+bool same_as_f2s(void)
+{
+    ken3::biunique_map<int, int, TYPE> bm;
+    for (int i = 0; i < 4000; i += 2) {
+        bm.insert(i, i * 3);
+    }
+    std::vector<int> fs;
+    std::vector<int> ss;
+    for (int i = 0; i < 3000; i++) {
+        fs.push_back((i * 37) % 4200);
+        ss.push_back((i * 37) % 12600);
+    }
+    std::vector<int> converted;
+    std::vector<int> rconverted;
+    bm.f2s_many(fs.begin(), fs.end(), std::back_inserter(converted), -1);
+    bm.s2f_many(ss.begin(), ss.end(), std::back_inserter(rconverted), -1);
+    for (std::size_t i = 0; i < fs.size(); i++) {
+        if ((converted[i] != (bm.has_f(fs[i]) ? bm.f2s(fs[i]) : -1)) ||
+            (rconverted[i] != (bm.has_s(ss[i]) ? bm.s2f(ss[i]) : -1))) {
+            return false;
+        }
+    }
+
+    std::vector<int> expected;
+    try {
+        for (auto i: fs) {
+            expected.push_back(bm.f2s(i));
+        }
+    }
+    catch (const std::out_of_range&) {
+        ;
+    }
+    converted.clear();
+    try {
+        bm.f2s_many(fs.begin(), fs.end(), std::back_inserter(converted));
+    }
+    catch (const std::out_of_range&) {
+        ;
+    }
+    return expected == converted;
+}
+/////////////////////////////////////////////////////////////////////////////
+
 } // namespace {
 
 const lest::test specification[] =
@@ -2650,6 +2801,527 @@ const lest::test specification[] =
         }
     },
 
+    CASE("reverse index is kept with forward map")
+    {
+        {
+            using my_map = std::tuple_element<0, map_list>::type;
+
+            my_map bm{{'A', 10}, {'B', 11}, {'C', 12}};
+            bm.erase_by_f('A');
+            EXPECT(not bm.has_s(10));
+            EXPECT_THROWS_AS(bm.s2f(10), std::out_of_range);
+            bm.insert('D', 10);
+            EXPECT('D' == bm.s2f(10));
+            bm.erase_by_s(11);
+            EXPECT(not bm.has_f('B'));
+            bm.insert('B', 13);
+            EXPECT('B' == bm.s2f(13));
+
+            my_map other{{'X', 20}};
+            bm.swap(other);
+            EXPECT('X' == bm.s2f(20));
+            EXPECT(not bm.has_s(10));
+            EXPECT('D' == other.s2f(10));
+            EXPECT(not other.has_s(20));
+
+            my_map copied(other);
+            other.clear();
+            EXPECT(not other.has_s(10));
+            EXPECT('C' == copied.s2f(12));
+            EXPECT(3UL == copied.size());
+        }
+        {
+            using my_map = std::tuple_element<3, map_list>::type;
+
+            my_map bm{{'A', 10}, {'B', 11}, {'C', 12}};
+            bm.erase_by_f('A');
+            EXPECT(not bm.has_s(10));
+            EXPECT_THROWS_AS(bm.s2f(10), std::out_of_range);
+            bm.insert('D', 10);
+            EXPECT('D' == bm.s2f(10));
+            bm.erase_by_s(11);
+            EXPECT(not bm.has_f('B'));
+            bm.insert('B', 13);
+            EXPECT('B' == bm.s2f(13));
+
+            my_map other{{'X', 20}};
+            bm.swap(other);
+            EXPECT('X' == bm.s2f(20));
+            EXPECT(not bm.has_s(10));
+            EXPECT('D' == other.s2f(10));
+            EXPECT(not other.has_s(20));
+
+            my_map copied(other);
+            other.clear();
+            EXPECT(not other.has_s(10));
+            EXPECT('C' == copied.s2f(12));
+            EXPECT(3UL == copied.size());
+        }
+        {
+            using my_map = std::tuple_element<4, map_list>::type;
+
+            my_map bm{{'A', 10}, {'B', 11}, {'C', 12}};
+            bm.erase_by_f('A');
+            EXPECT(not bm.has_s(10));
+            EXPECT_THROWS_AS(bm.s2f(10), std::out_of_range);
+            bm.insert('D', 10);
+            EXPECT('D' == bm.s2f(10));
+            bm.erase_by_s(11);
+            EXPECT(not bm.has_f('B'));
+            bm.insert('B', 13);
+            EXPECT('B' == bm.s2f(13));
+
+            my_map other{{'X', 20}};
+            bm.swap(other);
+            EXPECT('X' == bm.s2f(20));
+            EXPECT(not bm.has_s(10));
+            EXPECT('D' == other.s2f(10));
+            EXPECT(not other.has_s(20));
+
+            my_map copied(other);
+            other.clear();
+            EXPECT(not other.has_s(10));
+            EXPECT('C' == copied.s2f(12));
+            EXPECT(3UL == copied.size());
+        }
+        {
+            using my_map = std::tuple_element<7, map_list>::type;
+
+            my_map bm{{'A', 10}, {'B', 11}, {'C', 12}};
+            bm.erase_by_f('A');
+            EXPECT(not bm.has_s(10));
+            EXPECT_THROWS_AS(bm.s2f(10), std::out_of_range);
+            bm.insert('D', 10);
+            EXPECT('D' == bm.s2f(10));
+            bm.erase_by_s(11);
+            EXPECT(not bm.has_f('B'));
+            bm.insert('B', 13);
+            EXPECT('B' == bm.s2f(13));
+
+            my_map other{{'X', 20}};
+            bm.swap(other);
+            EXPECT('X' == bm.s2f(20));
+            EXPECT(not bm.has_s(10));
+            EXPECT('D' == other.s2f(10));
+            EXPECT(not other.has_s(20));
+
+            my_map copied(other);
+            other.clear();
+            EXPECT(not other.has_s(10));
+            EXPECT('C' == copied.s2f(12));
+            EXPECT(3UL == copied.size());
+        }
+    },
+
+    CASE("bulk insert with throwing policy is transactional")
+    {
+        {
+            using my_map = std::tuple_element<4, map_list>::type;
+
+            my_map bm{{'A', 0}};
+            std::vector<std::pair<char, int>> v;
+            for (int i = 1; i < 26; i++) {
+                v.emplace_back(static_cast<char>('A' + i), i);
+            }
+            v.emplace_back('a', 0);
+            EXPECT_THROWS_AS(bm.insert(v.begin(), v.end()), std::invalid_argument);
+            EXPECT(1UL == bm.size());
+            v.back() = std::make_pair('a', 20);
+            EXPECT_THROWS_AS(bm.insert(v.begin(), v.end()), std::invalid_argument);
+            EXPECT(1UL == bm.size());
+            v.back() = std::make_pair('Z', 100);
+            EXPECT_THROWS_AS(bm.insert(v.begin(), v.end()), std::invalid_argument);
+            EXPECT(1UL == bm.size());
+            v.pop_back();
+            bm.insert(v.begin(), v.end());
+            EXPECT(26UL == bm.size());
+            EXPECT('Z' == bm.s2f(25));
+        }
+        {
+            using my_map = std::tuple_element<5, map_list>::type;
+
+            my_map bm{{'A', 0}};
+            std::vector<std::pair<char, int>> v;
+            for (int i = 1; i < 26; i++) {
+                v.emplace_back(static_cast<char>('A' + i), i);
+            }
+            v.emplace_back('a', 0);
+            EXPECT_THROWS_AS(bm.insert(v.begin(), v.end()), std::invalid_argument);
+            EXPECT(1UL == bm.size());
+            v.back() = std::make_pair('a', 20);
+            EXPECT_THROWS_AS(bm.insert(v.begin(), v.end()), std::invalid_argument);
+            EXPECT(1UL == bm.size());
+            v.back() = std::make_pair('Z', 100);
+            EXPECT_THROWS_AS(bm.insert(v.begin(), v.end()), std::invalid_argument);
+            EXPECT(1UL == bm.size());
+            v.pop_back();
+            bm.insert(v.begin(), v.end());
+            EXPECT(26UL == bm.size());
+            EXPECT('Z' == bm.s2f(25));
+        }
+        {
+            using my_map = std::tuple_element<6, map_list>::type;
+
+            my_map bm{{'A', 0}};
+            std::vector<std::pair<char, int>> v;
+            for (int i = 1; i < 26; i++) {
+                v.emplace_back(static_cast<char>('A' + i), i);
+            }
+            v.emplace_back('a', 0);
+            EXPECT_THROWS_AS(bm.insert(v.begin(), v.end()), std::invalid_argument);
+            EXPECT(1UL == bm.size());
+            v.back() = std::make_pair('a', 20);
+            EXPECT_THROWS_AS(bm.insert(v.begin(), v.end()), std::invalid_argument);
+            EXPECT(1UL == bm.size());
+            v.back() = std::make_pair('Z', 100);
+            EXPECT_THROWS_AS(bm.insert(v.begin(), v.end()), std::invalid_argument);
+            EXPECT(1UL == bm.size());
+            v.pop_back();
+            bm.insert(v.begin(), v.end());
+            EXPECT(26UL == bm.size());
+            EXPECT('Z' == bm.s2f(25));
+        }
+        {
+            using my_map = std::tuple_element<7, map_list>::type;
+
+            my_map bm{{'A', 0}};
+            std::vector<std::pair<char, int>> v;
+            for (int i = 1; i < 26; i++) {
+                v.emplace_back(static_cast<char>('A' + i), i);
+            }
+            v.emplace_back('a', 0);
+            EXPECT_THROWS_AS(bm.insert(v.begin(), v.end()), std::invalid_argument);
+            EXPECT(1UL == bm.size());
+            v.back() = std::make_pair('a', 20);
+            EXPECT_THROWS_AS(bm.insert(v.begin(), v.end()), std::invalid_argument);
+            EXPECT(1UL == bm.size());
+            v.back() = std::make_pair('Z', 100);
+            EXPECT_THROWS_AS(bm.insert(v.begin(), v.end()), std::invalid_argument);
+            EXPECT(1UL == bm.size());
+            v.pop_back();
+            bm.insert(v.begin(), v.end());
+            EXPECT(26UL == bm.size());
+            EXPECT('Z' == bm.s2f(25));
+        }
+    },
+
+    CASE("flat_no_default")
+    {
+        {
+            using my_map = std::tuple_element<8, map_list>::type;
+
+            my_map bm{{'C', 12}, {'A', 10}, {'B', 10}, {'A', 11}, {'D', 13}};
+            EXPECT(same_map(bm, typename my_map::map_type{{'A', 10}, {'C', 12}, {'D', 13}}));
+            EXPECT('C' == bm.s2f(12));
+            EXPECT(13 == bm.f2s('D'));
+            EXPECT_THROWS_AS(bm.f2s('B'), std::out_of_range);
+            EXPECT_THROWS_AS(bm.s2f(11), std::out_of_range);
+            EXPECT('A' == bm.cbegin()->first);
+            EXPECT('D' == std::prev(bm.cend())->first);
+
+            bm.insert({{'B', 11}, {'E', 12}, {'F', 14}});
+            EXPECT(same_map(bm, typename my_map::map_type{{'A', 10}, {'B', 11}, {'C', 12}, {'D', 13}, {'F', 14}}));
+            bm.erase_by_s(11);
+            bm.erase_by_f('C');
+            EXPECT(same_map(bm, typename my_map::map_type{{'A', 10}, {'D', 13}, {'F', 14}}));
+            EXPECT(not bm.has_s(12));
+
+            bm.reserve(100);
+            bm.assign({{'Z', 1}, {'Y', 2}, {'X', 2}});
+            EXPECT(same_map(bm, typename my_map::map_type{{'Z', 1}, {'Y', 2}}));
+            EXPECT('Y' == bm.s2f(2));
+        }
+        {
+            using my_map = std::tuple_element<9, map_list>::type;
+
+            my_map bm{{'C', 12}, {'A', 10}};
+            EXPECT_THROWS_AS(my_map({{'A', 10}, {'B', 10}}), std::invalid_argument);
+            EXPECT_THROWS_AS(bm.insert({{'B', 11}, {'D', 12}}), std::invalid_argument);
+            EXPECT(same_map(bm, typename my_map::map_type{{'A', 10}, {'C', 12}}));
+            bm.insert({{'B', 11}, {'D', 13}});
+            EXPECT(same_map(bm, typename my_map::map_type{{'A', 10}, {'B', 11}, {'C', 12}, {'D', 13}}));
+            EXPECT_THROWS_AS(bm.assign({{'A', 1}, {'A', 2}}), std::invalid_argument);
+            EXPECT(4UL == bm.size());
+        }
+        {
+            using my_map = ken3::biunique_map<int, std::string, ken3::biunique_map_type::flat_no_default>;
+
+            std::vector<std::pair<int, std::string>> v;
+            for (int i = 999; i >= 0; i--) {
+                v.emplace_back(i, std::to_string(i * 7));
+            }
+            my_map bm;
+            bm.reserve(v.size());
+            bm.assign(v.begin(), v.end());
+            EXPECT(1000UL == bm.size());
+            for (int i = 0; i < 1000; i++) {
+                EXPECT(std::to_string(i * 7) == bm.f2s(i));
+                EXPECT(i == bm.s2f(std::to_string(i * 7)));
+            }
+        }
+    },
+
+    CASE("f2s_many() and s2f_many()")
+    {
+        const std::vector<char> fs{'C', 'A', 'X', 'B'};
+        const std::vector<int> ss{11, 13, 10};
+        {
+            using my_map = std::tuple_element<0, map_list>::type;
+
+            my_map bm{{'A', 10}, {'B', 11}, {'C', 12}};
+            std::vector<int> converted;
+            bm.f2s_many(fs.begin(), fs.end(), std::back_inserter(converted), -1);
+            EXPECT((std::vector<int>{12, 10, -1, 11}) == converted);
+            std::vector<char> rconverted(ss.size());
+            EXPECT(rconverted.end() == bm.s2f_many(ss.begin(), ss.end(), rconverted.begin(), '?'));
+            EXPECT((std::vector<char>{'B', '?', 'A'}) == rconverted);
+
+            converted.clear();
+            EXPECT_THROWS_AS(bm.f2s_many(fs.begin(), fs.end(), std::back_inserter(converted)), std::out_of_range);
+            EXPECT((std::vector<int>{12, 10}) == converted);
+            EXPECT_THROWS_AS(bm.s2f_many(ss.begin(), ss.end(), rconverted.begin()), std::out_of_range);
+        }
+        {
+            using my_map = std::tuple_element<1, map_list>::type;
+
+            // f2s_many() without default value is same as f2s()
+            my_map bm{{'A', 10}, {'B', 11}, {'C', 12}};
+            std::vector<int> converted;
+            bm.f2s_many(fs.begin(), fs.end(), std::back_inserter(converted));
+            EXPECT((std::vector<int>{12, 10, 10, 11}) == converted);
+            converted.clear();
+            bm.f2s_many(fs.begin(), fs.end(), std::back_inserter(converted), -1);
+            EXPECT((std::vector<int>{12, 10, -1, 11}) == converted);
+        }
+        {
+            using my_map = std::tuple_element<3, map_list>::type;
+
+            my_map bm{{'A', 10}, {'B', 11}, {'C', 12}};
+            std::vector<char> rconverted;
+            bm.s2f_many(ss.begin(), ss.end(), std::back_inserter(rconverted), '?');
+            EXPECT((std::vector<char>{'B', '?', 'A'}) == rconverted);
+        }
+        {
+            using my_map = std::tuple_element<8, map_list>::type;
+
+            my_map bm{{'A', 10}, {'B', 11}, {'C', 12}};
+            std::vector<int> converted;
+            bm.f2s_many(fs.begin(), fs.begin() + 2, std::back_inserter(converted));
+            EXPECT((std::vector<int>{12, 10}) == converted);
+        }
+        {
+            // large batches are looked up in sorted order
+            EXPECT(same_as_f2s<ken3::biunique_map_type::ordered_no_default>());
+            EXPECT(same_as_f2s<ken3::biunique_map_type::ordered_front_default>());
+            EXPECT(same_as_f2s<ken3::biunique_map_type::ordered_back_default>());
+            EXPECT(same_as_f2s<ken3::biunique_map_type::unordered_no_default>());
+            EXPECT(same_as_f2s<ken3::biunique_map_type::flat_no_default>());
+        }
+        {
+            using my_map = std::tuple_element<0, map_list>::type;
+
+            my_map bm{{'A', 10}, {'B', 11}, {'C', 12}};
+            std::vector<int> ss(40000, 12);
+            ss[1] = 13;
+            ss.back() = 10;
+            std::vector<char> rconverted(ss.size());
+            serial_pool pool;
+            EXPECT(rconverted.end() == bm.s2f_many(pool, ss.begin(), ss.end(), rconverted.begin(), '?'));
+            EXPECT(2UL == pool.calls);
+            EXPECT('C' == rconverted[0]);
+            EXPECT('?' == rconverted[1]);
+            EXPECT('C' == rconverted[20000]);
+            EXPECT('A' == rconverted.back());
+
+            std::vector<char> fs{'C', 'X'};
+            std::vector<int> converted(fs.size());
+            bm.f2s_many(pool, fs.begin(), fs.end(), converted.begin(), -1);
+            EXPECT(1UL == pool.calls);
+            EXPECT((std::vector<int>{12, -1}) == converted);
+        }
+    },
+
+    CASE("allocator")
+    {
+        {
+            using my_map = alloc_map<ken3::biunique_map_type::ordered_no_default, ken3::biunique_map_policy::silence>;
+
+            alloc_counter c;
+            {
+                my_map bm({{'A', 10}, {'B', 11}, {'C', 11}}, my_map::allocator_type(&c));
+                EXPECT(0UL < c.allocs);
+                EXPECT(&c == bm.get_allocator().counter);
+                EXPECT(2UL == bm.size());
+                bm.insert({{'D', 13}, {'E', 14}});
+                bm.erase_by_s(10);
+                EXPECT('E' == bm.s2f(14));
+
+                my_map copied(bm);
+                EXPECT(&c == copied.get_allocator().counter);
+                bm.assign({{'Z', 1}, {'Y', 2}});
+                bm = {{'X', 3}};
+                EXPECT(&c == bm.get_allocator().counter);
+                EXPECT('X' == bm.s2f(3));
+                EXPECT(3UL == copied.size());
+
+                my_map empty_map{my_map::allocator_type(&c)};
+                EXPECT(empty_map.empty());
+            }
+            EXPECT(0UL == c.live);
+        }
+        {
+            using my_map = alloc_map<ken3::biunique_map_type::unordered_no_default, ken3::biunique_map_policy::silence>;
+
+            alloc_counter c;
+            {
+                my_map bm({{'A', 10}, {'B', 11}, {'C', 11}}, my_map::allocator_type(&c));
+                EXPECT(0UL < c.allocs);
+                EXPECT(&c == bm.get_allocator().counter);
+                EXPECT(2UL == bm.size());
+                bm.insert({{'D', 13}, {'E', 14}});
+                bm.erase_by_s(10);
+                EXPECT('E' == bm.s2f(14));
+
+                my_map copied(bm);
+                EXPECT(&c == copied.get_allocator().counter);
+                bm.assign({{'Z', 1}, {'Y', 2}});
+                bm = {{'X', 3}};
+                EXPECT(&c == bm.get_allocator().counter);
+                EXPECT('X' == bm.s2f(3));
+                EXPECT(3UL == copied.size());
+
+                my_map empty_map{my_map::allocator_type(&c)};
+                EXPECT(empty_map.empty());
+            }
+            EXPECT(0UL == c.live);
+        }
+        {
+            using my_map = alloc_map<ken3::biunique_map_type::flat_no_default, ken3::biunique_map_policy::silence>;
+
+            alloc_counter c;
+            {
+                my_map bm({{'A', 10}, {'B', 11}, {'C', 11}}, my_map::allocator_type(&c));
+                EXPECT(0UL < c.allocs);
+                EXPECT(&c == bm.get_allocator().counter);
+                EXPECT(2UL == bm.size());
+                bm.insert({{'D', 13}, {'E', 14}});
+                bm.erase_by_s(10);
+                EXPECT('E' == bm.s2f(14));
+
+                my_map copied(bm);
+                EXPECT(&c == copied.get_allocator().counter);
+                bm.assign({{'Z', 1}, {'Y', 2}});
+                bm = {{'X', 3}};
+                EXPECT(&c == bm.get_allocator().counter);
+                EXPECT('X' == bm.s2f(3));
+                EXPECT(3UL == copied.size());
+
+                my_map empty_map{my_map::allocator_type(&c)};
+                EXPECT(empty_map.empty());
+            }
+            EXPECT(0UL == c.live);
+        }
+        {
+            using my_map = alloc_map<ken3::biunique_map_type::ordered_no_default, ken3::biunique_map_policy::throwing>;
+
+            alloc_counter c;
+            {
+                EXPECT_THROWS_AS(my_map({{'A', 10}, {'B', 11}, {'C', 11}}, my_map::allocator_type(&c)), std::invalid_argument);
+                my_map bm({{'A', 10}, {'B', 11}}, my_map::allocator_type(&c));
+                EXPECT(0UL < c.allocs);
+                EXPECT(&c == bm.get_allocator().counter);
+                EXPECT_THROWS_AS(bm.insert({{'F', 15}, {'G', 15}}), std::invalid_argument);
+                bm.insert({{'D', 13}, {'E', 14}});
+
+                // a single item is inserted without temporary sets
+                const std::size_t allocs = c.allocs;
+                bm.insert('H', 17);
+                EXPECT(2UL == c.allocs - allocs);
+                bm.erase_by_s(17);
+                bm.erase_by_s(10);
+                EXPECT('E' == bm.s2f(14));
+
+                my_map copied(bm);
+                EXPECT(&c == copied.get_allocator().counter);
+                bm.assign({{'Z', 1}, {'Y', 2}});
+                bm = {{'X', 3}};
+                EXPECT(&c == bm.get_allocator().counter);
+                EXPECT('X' == bm.s2f(3));
+                EXPECT(3UL == copied.size());
+
+                my_map empty_map{my_map::allocator_type(&c)};
+                EXPECT(empty_map.empty());
+            }
+            EXPECT(0UL == c.live);
+        }
+        {
+            using my_map = alloc_map<ken3::biunique_map_type::unordered_no_default, ken3::biunique_map_policy::throwing>;
+
+            alloc_counter c;
+            {
+                EXPECT_THROWS_AS(my_map({{'A', 10}, {'B', 11}, {'C', 11}}, my_map::allocator_type(&c)), std::invalid_argument);
+                my_map bm({{'A', 10}, {'B', 11}}, my_map::allocator_type(&c));
+                EXPECT(0UL < c.allocs);
+                EXPECT(&c == bm.get_allocator().counter);
+                EXPECT_THROWS_AS(bm.insert({{'F', 15}, {'G', 15}}), std::invalid_argument);
+                bm.insert({{'D', 13}, {'E', 14}});
+                bm.erase_by_s(10);
+                EXPECT('E' == bm.s2f(14));
+
+                my_map copied(bm);
+                EXPECT(&c == copied.get_allocator().counter);
+                bm.assign({{'Z', 1}, {'Y', 2}});
+                bm = {{'X', 3}};
+                EXPECT(&c == bm.get_allocator().counter);
+                EXPECT('X' == bm.s2f(3));
+                EXPECT(3UL == copied.size());
+
+                my_map empty_map{my_map::allocator_type(&c)};
+                EXPECT(empty_map.empty());
+            }
+            EXPECT(0UL == c.live);
+        }
+        {
+            using my_map = alloc_map<ken3::biunique_map_type::flat_no_default, ken3::biunique_map_policy::throwing>;
+
+            alloc_counter c;
+            {
+                EXPECT_THROWS_AS(my_map({{'A', 10}, {'B', 11}, {'C', 11}}, my_map::allocator_type(&c)), std::invalid_argument);
+                my_map bm({{'A', 10}, {'B', 11}}, my_map::allocator_type(&c));
+                EXPECT(0UL < c.allocs);
+                EXPECT(&c == bm.get_allocator().counter);
+                EXPECT_THROWS_AS(bm.insert({{'F', 15}, {'G', 15}}), std::invalid_argument);
+                bm.insert({{'D', 13}, {'E', 14}});
+                bm.erase_by_s(10);
+                EXPECT('E' == bm.s2f(14));
+
+                my_map copied(bm);
+                EXPECT(&c == copied.get_allocator().counter);
+                bm.assign({{'Z', 1}, {'Y', 2}});
+                bm = {{'X', 3}};
+                EXPECT(&c == bm.get_allocator().counter);
+                EXPECT('X' == bm.s2f(3));
+                EXPECT(3UL == copied.size());
+
+                my_map empty_map{my_map::allocator_type(&c)};
+                EXPECT(empty_map.empty());
+            }
+            EXPECT(0UL == c.live);
+        }
+#if __cplusplus >= 201703L
+        {
+            using my_map = ken3::pmr::biunique_map<char, int, ken3::biunique_map_type::flat_no_default>;
+
+            char buffer[4096];
+            std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+            my_map bm({{'A', 10}, {'B', 11}}, &arena);
+            bm.insert('C', 12);
+            EXPECT('C' == bm.s2f(12));
+            EXPECT(&arena == bm.get_allocator().resource());
+        }
+#endif
+    },
+
 };
 
 int main(int argc, char* argv[])
@@ -0,0 +1,293 @@
+/**
+ * @file    unittest/fraction/accumulator_test.cpp
+ * @brief   Testing ken3::fraction_accumulator using lest.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "ken3/fraction/accumulator.hpp"
+#include "unittest/lest.hpp"
+
+namespace {
+
+/**
+ * @brief      get terms for tests. denominators are various and sometimes same.
+ * @return     fractions
+ */
+std::vector<ken3::fraction> terms(void)
+{
+    std::vector<ken3::fraction> v;
+    for (int i = 1; i <= 300; i++) {
+        v.emplace_back((i % 3 == 0) ? -i : i, (i % 4 == 0) ? 12 : (i % 7) + 1);
+    }
+    return v;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+using fraction8 = ken3::basic_fraction<std::int8_t>;
+using accumulator8 = ken3::basic_fraction_accumulator<std::int8_t>;
+using exact_type = std::pair<long long, long long>;
+
+/**
+ * @brief      reduce n/d exactly in long long, as the reference of accumulator8.
+ * @param[in]  n: numerator
+ * @param[in]  d: denominator (!= 0)
+ * @return     reduced pair whose denominator is > 0.
+ */
+exact_type exact(long long n, long long d)
+{
+    long long x = (n < 0) ? -n : n;
+    long long y = (d < 0) ? -d : d;
+    while (y != 0) {
+        const long long r = x % y;
+        x = y;
+        y = r;
+    }
+    const long long g = (n == 0) ? ((d < 0) ? -d : d) : x;
+    return (d < 0) ? exact_type(-n / g, -d / g) : exact_type(n / g, d / g);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      check whether the exact value is representable by fraction8.
+ * @param[in]  x: exact value
+ * @return     true: representable. false: otherwise.
+ */
+bool representable(const exact_type& x)
+{
+    return (-128 <= x.first) && (x.first <= 127) && (x.second <= 127);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      apply an operator to accumulator8, and check the result
+ *             against the exact reference.
+ * @param[in]  acc: accumulator, which may be not reduced
+ * @param[in]  op: 0: +=, 1: -=, 2: *=, 3: /=
+ * @param[in]  rhs: right hand side of the operator
+ * @param[in]  expected: exact result
+ * @return     true: the result is same as expected, or std::overflow_error
+ *             is thrown and expected is not representable. false: otherwise.
+ */
+bool same_as_exact(accumulator8 acc, int op, const fraction8& rhs, const exact_type& expected)
+{
+    try {
+        switch (op) {
+        case 0: acc += rhs; break;
+        case 1: acc -= rhs; break;
+        case 2: acc *= rhs; break;
+        default: acc /= rhs; break;
+        }
+    }
+    catch (const std::overflow_error&) {
+        return not representable(expected);
+    }
+    return representable(expected) &&
+           (acc.value().numerator() == expected.first) && (acc.value().denominator() == expected.second);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      compare the operators of accumulator8 with the exact reference
+ *             for each pair of samples. each lhs is also checked after
+ *             (*= 3/7) and (/= 3/7), which leave it not reduced.
+ * @param[in]  v: samples
+ * @return     the number of mismatches of results or exceptions
+ */
+std::size_t exact_mismatches(const std::vector<fraction8>& v)
+{
+    std::size_t count = 0;
+    for (const auto& lhs: v) {
+        std::vector<accumulator8> accs{accumulator8{lhs}};
+        if (representable(exact(lhs.numerator() * 3LL, lhs.denominator() * 7LL))) {
+            accs.push_back(accumulator8{lhs});
+            accs.back() *= fraction8(3, 7);
+            accs.back() /= fraction8(3, 7);
+        }
+        for (const auto& rhs: v) {
+            const long long n1 = lhs.numerator(), d1 = lhs.denominator();
+            const long long n2 = rhs.numerator(), d2 = rhs.denominator();
+            const exact_type expected[3] = {exact(n1 * d2 + n2 * d1, d1 * d2), exact(n1 * d2 - n2 * d1, d1 * d2),
+                                            exact(n1 * n2, d1 * d2)};
+            for (const auto& acc: accs) {
+                for (int op = 0; op < 3; op++) {
+                    count += same_as_exact(acc, op, rhs, expected[op]) ? 0 : 1;
+                }
+                if (n2 != 0) {
+                    count += same_as_exact(acc, 3, rhs, exact(n1 * d2, d1 * n2)) ? 0 : 1;
+                }
+            }
+        }
+    }
+    return count;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      get samples of fraction8, whose numerators are near the
+ *             limits or 0, with some denominators.
+ * @return     fractions
+ */
+std::vector<fraction8> samples8(void)
+{
+    std::vector<fraction8> v;
+    for (int n = -128; n <= 127; n++) {
+        if ((-96 < n && n < -8) || (8 < n && n < 96)) {
+            continue;
+        }
+        for (int d: {1, 5, 35, 65, 69}) {
+            v.push_back(fraction8(std::int8_t(n), std::int8_t(d)));
+        }
+    }
+    return v;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace {
+
+const lest::test specification[] =
+{
+
+    CASE("constructors and value()")
+    {
+        using ken3::fraction;
+        using ken3::fraction_accumulator;
+        using pair_type = fraction_accumulator::pair_type;
+
+        EXPECT(fraction{} == fraction_accumulator{}.value());
+        EXPECT(fraction(2, 3) == fraction_accumulator{fraction(4, 6)}.value());
+        EXPECT(pair_type(2, 3) == fraction_accumulator{fraction(4, 6)}());
+
+        std::ostringstream oss;
+        oss << fraction_accumulator{fraction(1, 2)};
+        EXPECT("1/2" == oss.str());
+    },
+
+    CASE("lazy reduction")
+    {
+        using ken3::fraction;
+        using ken3::fraction_accumulator;
+        using pair_type = fraction_accumulator::pair_type;
+
+        fraction_accumulator acc;
+        acc += fraction(1, 4);
+        acc += fraction(1, 4);
+        EXPECT(pair_type(2, 4) == acc());
+        EXPECT(fraction(1, 2) == acc.value());
+        acc *= fraction(2, 3);
+        EXPECT(pair_type(4, 12) == acc());
+        acc /= fraction(-2, 3);
+        EXPECT(pair_type(-12, 24) == acc());
+        acc -= fraction(1, 2);
+        EXPECT(fraction(-1, 1) == acc.value());
+        acc.reduce();
+        EXPECT(pair_type(-1, 1) == acc());
+    },
+
+    CASE("same as eager results")
+    {
+        using ken3::fraction;
+        using ken3::fraction_accumulator;
+
+        fraction eager;
+        fraction_accumulator lazy;
+        for (const auto& i: terms()) {
+            eager += i;
+            lazy += i;
+        }
+        EXPECT(eager == lazy.value());
+
+        fraction eager_product(1, 1);
+        fraction_accumulator lazy_product{fraction(1, 1)};
+        for (int i = 1; i <= 40; i++) {
+            eager_product *= fraction(i + 1, i);
+            lazy_product *= fraction(i + 1, i);
+            eager_product /= fraction(i, -(i + 2));
+            lazy_product /= fraction(i, -(i + 2));
+        }
+        EXPECT(eager_product == lazy_product.value());
+
+        fraction eager_harmonic;
+        fraction_accumulator lazy_harmonic;
+        for (int i = 1; i <= 40; i++) {
+            eager_harmonic -= fraction(1, i);
+            lazy_harmonic -= fraction(1, i);
+        }
+        EXPECT(eager_harmonic == lazy_harmonic.value());
+    },
+
+    CASE("comparisons")
+    {
+        using ken3::fraction;
+        using ken3::fraction_accumulator;
+
+        fraction_accumulator acc;
+        acc += fraction(1, 6);
+        acc += fraction(1, 6);
+        EXPECT(acc == fraction(1, 3));
+        EXPECT(fraction(1, 3) == acc);
+        EXPECT(acc != fraction(1, 2));
+        EXPECT(acc < fraction(1, 2));
+        EXPECT(acc > fraction(1, 4));
+        EXPECT(acc <= fraction(1, 3));
+        EXPECT(acc >= fraction(1, 3));
+    },
+
+    CASE("overflow")
+    {
+        using ken3::fraction;
+        using ken3::fraction_accumulator;
+        using limit = std::numeric_limits<fraction::int_type>;
+
+        // reduced when the next operation makes overflow
+        fraction_accumulator acc;
+        for (int i = 0; i < 200; i++) {
+            acc += fraction(limit::max() / 100, 3);
+            acc -= fraction(limit::max() / 100, 3);
+            acc += fraction(1, 7);
+        }
+        EXPECT(fraction(200, 7) == acc.value());
+
+        // the same exceptions as fraction
+        fraction_accumulator big{fraction(limit::max(), 1)};
+        EXPECT_THROWS_AS(big += fraction(1, 1), std::overflow_error);
+        EXPECT_THROWS_AS(big *= fraction(2, 1), std::overflow_error);
+        EXPECT_THROWS_AS(big /= fraction(0, 1), std::runtime_error);
+        EXPECT(fraction(limit::max(), 1) == big.value());
+        fraction_accumulator small{fraction(limit::min(), 1)};
+        EXPECT_THROWS_AS(small /= fraction(-1, 1), std::overflow_error);
+        small /= fraction(limit::min(), 1);
+        EXPECT(fraction(1, 1) == small.value());
+        EXPECT_THROWS_AS(small -= fraction(limit::min(), 1), std::overflow_error);
+        small -= fraction(2, 1);
+        small -= fraction(limit::min(), 1);
+        EXPECT(fraction(limit::max(), 1) == small.value());
+    },
+
+    CASE("same as exact results")
+    {
+        accumulator8 quotient{fraction8(-96, 5)};
+        quotient /= fraction8(-128, 35);
+        EXPECT(fraction8(21, 4) == quotient.value());
+        accumulator8 big{fraction8(68, 69)};
+        EXPECT_THROWS_AS(big /= fraction8(-128, 65), std::overflow_error);
+
+        EXPECT(0UL == exact_mismatches(samples8()));
+    },
+
+};
+
+int main(int argc, char* argv[])
+{
+    return lest::run(specification, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
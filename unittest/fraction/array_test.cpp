@@ -0,0 +1,186 @@
+/**
+ * @file    unittest/fraction/array_test.cpp
+ * @brief   Testing ken3::fraction_array using lest.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ */
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "ken3/fraction/array.hpp"
+#include "unittest/lest.hpp"
+
+namespace {
+
+/**
+ * @brief      get fractions for tests, which include extreme values.
+ * @return     fractions
+ */
+std::vector<ken3::fraction> samples(void)
+{
+    using ken3::fraction;
+    using limit = std::numeric_limits<fraction::int_type>;
+
+    std::vector<fraction> v{fraction(0, 1), fraction(limit::max(), 1), fraction(limit::min(), 1),
+                            fraction(1, limit::max()), fraction(limit::max(), 2), fraction(-1, limit::max() - 1),
+                            fraction(-1, 1), fraction(limit::min(), 3)};
+    for (int i = 1; i <= 50; i++) {
+        v.emplace_back((i % 2 == 0) ? -i * 7 : i * 3, i * 5 + 1);
+    }
+    return v;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace {
+
+const lest::test specification[] =
+{
+
+    CASE("constructors and accessors")
+    {
+        using ken3::fraction;
+        using ken3::fraction_array;
+
+        EXPECT(fraction_array{}.empty());
+        fraction_array zeros(3);
+        EXPECT(3UL == zeros.size());
+        EXPECT(fraction() == zeros[2]);
+
+        fraction_array a{fraction(1, 2), fraction(-4, 6)};
+        EXPECT(2UL == a.size());
+        EXPECT(fraction(-2, 3) == a[1]);
+        EXPECT(-2 == a.numerators()[1]);
+        EXPECT(3 == a.denominators()[1]);
+        a.set(0, fraction(5, 7));
+        a.push_back(fraction(1, 3));
+        EXPECT(fraction(5, 7) == a[0]);
+        EXPECT(fraction(1, 3) == a[2]);
+    },
+
+    CASE("same as operators of fraction")
+    {
+        using ken3::fraction;
+        using ken3::fraction_array;
+
+        const std::vector<fraction> v = samples();
+        const fraction ks[] = {fraction(3, 4), fraction(-7, 5), fraction(0, 1), fraction(2, 1)};
+        for (const auto& k: ks) {
+            fraction_array product(v.begin(), v.end());
+            fraction_array sum(v.begin(), v.end());
+            fraction_array::mask_type product_overflow = product.multiply(k);
+            fraction_array::mask_type sum_overflow = sum.add(k);
+            for (std::size_t i = 0; i < v.size(); i++) {
+                try {
+                    fraction expected = v[i] * k;
+                    EXPECT(0 == product_overflow[i]);
+                    EXPECT(expected == product[i]);
+                }
+                catch (const std::overflow_error&) {
+                    EXPECT(1 == product_overflow[i]);
+                    EXPECT(v[i] == product[i]);
+                }
+                try {
+                    fraction expected = v[i] + k;
+                    EXPECT(0 == sum_overflow[i]);
+                    EXPECT(expected == sum[i]);
+                }
+                catch (const std::overflow_error&) {
+                    EXPECT(1 == sum_overflow[i]);
+                    EXPECT(v[i] == sum[i]);
+                }
+            }
+        }
+    },
+
+    CASE("element wise operations")
+    {
+        using ken3::fraction;
+        using ken3::fraction_array;
+
+        const std::vector<fraction> v = samples();
+        std::vector<fraction> w(v.rbegin(), v.rend());
+        fraction_array product(v.begin(), v.end());
+        fraction_array sum(v.begin(), v.end());
+        fraction_array difference(v.begin(), v.end());
+        const fraction_array rhs(w.begin(), w.end());
+        fraction_array::mask_type product_overflow = product.multiply(rhs);
+        fraction_array::mask_type sum_overflow = sum.add(rhs);
+        fraction_array::mask_type difference_overflow = difference.subtract(rhs);
+        std::size_t overflow_count = 0;
+        for (std::size_t i = 0; i < v.size(); i++) {
+            fraction expected[3];
+            bool thrown[3] = {false, false, false};
+            try {
+                expected[0] = v[i] * w[i];
+            }
+            catch (const std::overflow_error&) {
+                thrown[0] = true;
+            }
+            try {
+                expected[1] = v[i] + w[i];
+            }
+            catch (const std::overflow_error&) {
+                thrown[1] = true;
+            }
+            try {
+                expected[2] = v[i] - w[i];
+            }
+            catch (const std::overflow_error&) {
+                thrown[2] = true;
+            }
+            EXPECT(thrown[0] == (product_overflow[i] == 1));
+            EXPECT(thrown[1] == (sum_overflow[i] == 1));
+            EXPECT(thrown[2] == (difference_overflow[i] == 1));
+            EXPECT((thrown[0] ? v[i] : expected[0]) == product[i]);
+            EXPECT((thrown[1] ? v[i] : expected[1]) == sum[i]);
+            EXPECT((thrown[2] ? v[i] : expected[2]) == difference[i]);
+            overflow_count += product_overflow[i] + sum_overflow[i] + difference_overflow[i];
+        }
+        EXPECT(0UL < overflow_count);
+
+        using limit = std::numeric_limits<fraction::int_type>;
+        fraction_array minus_one{fraction(-1, 1), fraction(0, 1)};
+        fraction_array::mask_type overflow = minus_one.subtract(fraction_array{fraction(limit::min(), 1), fraction(limit::min(), 1)});
+        EXPECT(0 == overflow[0]);
+        EXPECT(1 == overflow[1]);
+        EXPECT(fraction(limit::max(), 1) == minus_one[0]);
+        EXPECT(fraction(0, 1) == minus_one[1]);
+
+        fraction_array shorter{fraction(1, 2)};
+        EXPECT_THROWS_AS(shorter.add(rhs), std::invalid_argument);
+        EXPECT_THROWS_AS(shorter.multiply(rhs), std::invalid_argument);
+        EXPECT_THROWS_AS(shorter.subtract(rhs), std::invalid_argument);
+    },
+
+    CASE("basic_fraction_array of __int128")
+    {
+#if defined(__SIZEOF_INT128__)
+        using fraction128 = ken3::basic_fraction<__int128>;
+        using array128 = ken3::basic_fraction_array<__int128>;
+        using limit128 = ken3::fraction_detail::int_traits<__int128>;
+
+        array128 a{fraction128(1, 2), fraction128(limit128::max(), 3)};
+        array128::mask_type overflow = a.multiply(fraction128(3, 4));
+        EXPECT(0 == overflow[0]);
+        EXPECT(0 == overflow[1]);
+        EXPECT(true == (fraction128(3, 8) == a[0]));
+        EXPECT(true == (fraction128(limit128::max(), 4) == a[1]));
+        overflow = a.add(fraction128(1, 4));
+        EXPECT(0 == overflow[0]);
+        EXPECT(true == (fraction128(5, 8) == a[0]));
+        EXPECT(1 == overflow[1]);
+        EXPECT(true == (fraction128(limit128::max(), 4) == a[1]));
+#endif
+    },
+
+};
+
+int main(int argc, char* argv[])
+{
+    return lest::run(specification, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,145 @@
+/**
+ * @file    unittest/fraction/wide_int_test.cpp
+ * @brief   Testing ken3::wide_int and ken3::basic_fraction<ken3::wide_int> using lest.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ */
+
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "ken3/fraction/wide_int.hpp"
+#include "unittest/lest.hpp"
+
+namespace {
+
+/**
+ * @brief      get decimal string of value.
+ * @param[in]  x: value
+ * @return     decimal string
+ */
+template <typename T>
+std::string str(const T& x)
+{
+    std::ostringstream oss;
+    oss << x;
+    return oss.str();
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace {
+
+const lest::test specification[] =
+{
+
+    CASE("constructors and casts")
+    {
+        using w128 = ken3::wide_int<128>;
+        using w256 = ken3::wide_int<256>;
+        using limit = std::numeric_limits<std::intmax_t>;
+
+        EXPECT("0" == str(w128{}));
+        EXPECT("-1" == str(w128{-1}));
+        EXPECT(str(limit::min()) == str(w128{limit::min()}));
+        EXPECT(limit::max() == static_cast<std::intmax_t>(w128{limit::max()}));
+        EXPECT("-12345" == str(w256{w128{-12345}}));
+        EXPECT("-12345" == str(w128{w256{-12345}}));
+        EXPECT(-0.5 == static_cast<double>(w128{-1}) / 2.0);
+        EXPECT(1.0e30 < static_cast<double>(w128{1} << 100));
+        EXPECT("170141183460469231731687303715884105727" == str(w128::max()));
+        EXPECT("-170141183460469231731687303715884105728" == str(w128::min()));
+        EXPECT(w128::max() == std::numeric_limits<w128>::max());
+        EXPECT(255 == std::numeric_limits<w256>::digits);
+    },
+
+    CASE("arithmetic operators")
+    {
+        using w128 = ken3::wide_int<128>;
+        using w256 = ken3::wide_int<256>;
+        using limit = std::numeric_limits<std::intmax_t>;
+
+        const w128 big = w128{limit::max()} * w128{limit::max()};
+        EXPECT("85070591730234615847396907784232501249" == str(big));
+        EXPECT(w128{limit::max()} == big / w128{limit::max()});
+        EXPECT(w128{0} == big % w128{limit::max()});
+        EXPECT(w128{-7} / w128{2} == w128{-3});
+        EXPECT(w128{-7} % w128{2} == w128{-1});
+        EXPECT(w128{7} / w128{-2} == w128{-3});
+        EXPECT(w128{7} % w128{-2} == w128{1});
+        EXPECT((big + big) - big == big);
+        EXPECT(-(-big) == big);
+        EXPECT(w128::min() == w128::max() + w128{1});
+        EXPECT(w128::min() / w128{-1} == w128::min());
+        EXPECT((big * big) / big == big * big / big);
+        EXPECT(w256{big} * w256{big} / w256{big} == w256{big});
+        EXPECT(w256{big} * w256{-big} / w256{big} == w256{-big});
+        EXPECT(str(w256{big} * w256{big} % w256{1000000007}) == "22087756");
+        EXPECT("1000000000000000000000" == str(w128{1000000000000LL} * w128{1000000000LL}));
+    },
+
+    CASE("bit operators and comparisons")
+    {
+        using w128 = ken3::wide_int<128>;
+        using w192 = ken3::wide_int<192>;
+
+        EXPECT((w128{1} << 127) == w128::min());
+        EXPECT((w128::min() >> 127) == w128{-1});
+        EXPECT((w128{1} << 64 >> 64) == w128{1});
+        EXPECT((w128{3} << 65 >> 1) == (w128{3} << 64));
+        EXPECT((w192{-1} << 191) == w192::min());
+        EXPECT((w128{6} & w128{3}) == w128{2});
+        EXPECT((w128{6} | w128{3}) == w128{7});
+        EXPECT((~w128{0}) == w128{-1});
+        EXPECT(0 == w128{1}.count_trailing_zeros());
+        EXPECT(100 == (w128{1} << 100).count_trailing_zeros());
+        EXPECT(128 == w128{0}.count_trailing_zeros());
+        EXPECT(w128{-1} < w128{0});
+        EXPECT(w128::min() < w128{-1});
+        EXPECT(w128{1} < (w128{1} << 64));
+        EXPECT(w128{-1} > ((w128{-1} << 64)));
+        EXPECT(w128{5} >= w128{5});
+        EXPECT(w128{5} <= w128{5});
+        EXPECT(w128{5} != w128{6});
+    },
+
+    CASE("basic_fraction<wide_int>")
+    {
+        using w128 = ken3::wide_int<128>;
+        using fraction = ken3::basic_fraction<w128>;
+
+        EXPECT(fraction(1, 2) == fraction(w128{1} << 100, w128{1} << 101));
+        EXPECT(fraction(5, 6) == fraction(1, 2) + fraction(1, 3));
+        EXPECT(fraction(-1, 6) == fraction(1, 3) - fraction(1, 2));
+        EXPECT(fraction(1, 6) == fraction(1, 2) * fraction(1, 3));
+        EXPECT(fraction(3, 2) == fraction(1, 2) / fraction(1, 3));
+        EXPECT(fraction(1, 3) < fraction(1, 2));
+        EXPECT(fraction(w128::max() - w128{2}, w128::max() - w128{1}) < fraction(w128::max() - w128{1}, w128::max()));
+        EXPECT("1/9" == str(fraction(1, 3) * fraction(1, 3)));
+        EXPECT(0.25 == static_cast<double>(fraction(1, 4)));
+
+        // intermediates are calculated in 256 bits
+        const fraction half_max(w128::max(), 2);
+        EXPECT(fraction(w128::max(), 1) == half_max + half_max);
+        EXPECT(fraction(1, 1) == fraction(w128::max(), w128::max() - w128{1}) * fraction(w128::max() - w128{1}, w128::max()));
+        EXPECT_THROWS_AS(fraction(w128::max(), 1) + fraction(1, 1), std::overflow_error);
+        EXPECT_THROWS_AS(fraction(w128::max(), 1) * fraction(2, 1), std::overflow_error);
+        EXPECT_THROWS_AS(fraction(1, 0), std::runtime_error);
+
+        fraction sum;
+        for (int i = 1; i <= 40; i++) {
+            sum += fraction(1, i);
+        }
+        EXPECT("2078178381193813/485721041551200" == str(sum));
+    },
+
+};
+
+int main(int argc, char* argv[])
+{
+    return lest::run(specification, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
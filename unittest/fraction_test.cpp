@@ -7,10 +7,198 @@
  * @remark  the target is C++11 or more
  */
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <map>
 #include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 #include "ken3/fraction.hpp"
 #include "unittest/lest.hpp"
 
+namespace {
+
+using fraction8 = ken3::basic_fraction<std::int8_t>;
+using exact_type = std::pair<long long, long long>;
+
+/**
+ * @brief      reduce n/d exactly in long long, as the reference of fraction8.
+ * @param[in]  n: numerator
+ * @param[in]  d: denominator (!= 0)
+ * @return     reduced pair whose denominator is > 0.
+ */
+exact_type exact(long long n, long long d)
+{
+    long long x = (n < 0) ? -n : n;
+    long long y = (d < 0) ? -d : d;
+    while (y != 0) {
+        const long long r = x % y;
+        x = y;
+        y = r;
+    }
+    const long long g = (n == 0) ? ((d < 0) ? -d : d) : x;
+    return (d < 0) ? exact_type(-n / g, -d / g) : exact_type(n / g, d / g);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      check the result of fraction8 against the exact reference.
+ * @param[in]  e: error code of the result
+ * @param[in]  f: result
+ * @param[in]  expected: exact result
+ * @return     true: e is ok and f is same as expected, or e is overflow and
+ *             expected is not representable. false: otherwise.
+ */
+bool same_as_exact(ken3::fraction_errc e, const fraction8& f, const exact_type& expected)
+{
+    const bool representable = (-128 <= expected.first) && (expected.first <= 127) && (expected.second <= 127);
+    return representable ?
+        ((e == ken3::fraction_errc::ok) && (f.numerator() == expected.first) && (f.denominator() == expected.second)) :
+        (e == ken3::fraction_errc::overflow);
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      get the error code which corresponds to the thrown exception.
+ * @param[in]  f: function which may throw
+ * @return     error code
+ */
+template <typename Function>
+ken3::fraction_errc error_of(Function f)
+{
+    try {
+        f();
+    }
+    catch (const std::overflow_error&) {
+        return ken3::fraction_errc::overflow;
+    }
+    catch (const std::runtime_error&) {
+        return ken3::fraction_errc::zero_denominator;
+    }
+    return ken3::fraction_errc::ok;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      compare the operators and try_*() of fraction8 with the exact
+ *             reference for each pair of samples.
+ * @param[in]  v: samples
+ * @return     the number of mismatches of results or errors
+ */
+std::size_t exact_mismatches(const std::vector<fraction8>& v)
+{
+    std::size_t count = 0;
+    for (const auto& lhs: v) {
+        for (const auto& rhs: v) {
+            const long long n1 = lhs.numerator(), d1 = lhs.denominator();
+            const long long n2 = rhs.numerator(), d2 = rhs.denominator();
+            const exact_type expected[3] = {exact(n1 * d2 + n2 * d1, d1 * d2), exact(n1 * d2 - n2 * d1, d1 * d2),
+                                            exact(n1 * n2, d1 * d2)};
+            fraction8 thrown[4] = {lhs, lhs, lhs, lhs};
+            const ken3::fraction_errc errors[4] = {
+                error_of([&]() { thrown[0] = lhs + rhs; }),
+                error_of([&]() { thrown[1] = lhs - rhs; }),
+                error_of([&]() { thrown[2] = lhs * rhs; }),
+                error_of([&]() { thrown[3] = lhs / rhs; }),
+            };
+            fraction8 actual[4] = {lhs, lhs, lhs, lhs};
+            const ken3::fraction_errc results[4] = {
+                actual[0].try_add(rhs), actual[1].try_sub(rhs), actual[2].try_mul(rhs), actual[3].try_div(rhs),
+            };
+            for (int i = 0; i < 3; i++) {
+                count += same_as_exact(errors[i], thrown[i], expected[i]) ? 0 : 1;
+                count += same_as_exact(results[i], actual[i], expected[i]) ? 0 : 1;
+            }
+            if (n2 == 0) {
+                count += (errors[3] == ken3::fraction_errc::zero_denominator) ? 0 : 1;
+                count += ((results[3] == ken3::fraction_errc::zero_denominator) && (actual[3] == lhs)) ? 0 : 1;
+            }
+            else {
+                count += same_as_exact(errors[3], thrown[3], exact(n1 * d2, d1 * n2)) ? 0 : 1;
+                count += same_as_exact(results[3], actual[3], exact(n1 * d2, d1 * n2)) ? 0 : 1;
+            }
+        }
+    }
+    return count;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      get samples of fraction8, whose numerators are near the
+ *             limits or 0, with some denominators.
+ * @return     fractions
+ */
+std::vector<fraction8> samples8(void)
+{
+    std::vector<fraction8> v;
+    for (int n = -128; n <= 127; n++) {
+        if ((-96 < n && n < -8) || (8 < n && n < 96)) {
+            continue;
+        }
+        for (int d: {1, 3, 5, 35, 64, 65, 69, 127}) {
+            v.push_back(fraction8(std::int8_t(n), std::int8_t(d)));
+        }
+    }
+    return v;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      compare try_*() with the operators for each pair of samples.
+ * @param[in]  v: samples
+ * @tparam     F: basic_fraction
+ * @return     the number of mismatches of results or errors
+ */
+template <typename F>
+std::size_t mismatches(const std::vector<F>& v)
+{
+    std::size_t count = 0;
+    for (const auto& lhs: v) {
+        for (const auto& rhs: v) {
+            F expected[4] = {lhs, lhs, lhs, lhs};
+            const ken3::fraction_errc errors[4] = {
+                error_of([&]() { expected[0] = lhs + rhs; }),
+                error_of([&]() { expected[1] = lhs - rhs; }),
+                error_of([&]() { expected[2] = lhs * rhs; }),
+                error_of([&]() { expected[3] = lhs / rhs; }),
+            };
+            F actual[4] = {lhs, lhs, lhs, lhs};
+            const ken3::fraction_errc results[4] = {
+                actual[0].try_add(rhs), actual[1].try_sub(rhs), actual[2].try_mul(rhs), actual[3].try_div(rhs),
+            };
+            for (int i = 0; i < 4; i++) {
+                count += ((errors[i] != results[i]) || not (expected[i] == actual[i])) ? 1 : 0;
+            }
+        }
+    }
+    return count;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      get samples for tests, which include extreme values.
+ * @tparam     F: basic_fraction
+ * @return     fractions
+ */
+template <typename F>
+std::vector<F> extremes(void)
+{
+    using int_type = typename F::int_type;
+    using limit = ken3::fraction_detail::int_traits<int_type>;
+
+    std::vector<F> v{F(0, 1), F(1, 1), F(-1, 1), F(2, 3), F(-7, 5), F(limit::max(), 1), F(limit::min(), 1),
+                     F(1, limit::max()), F(-1, limit::max()), F(limit::max(), 2), F(limit::min(), 3),
+                     F(limit::max() - 1, limit::max()), F(2, limit::max() - 1), F(limit::min() / 2, 1),
+                     F(1, 2), F(-1, 2), F(limit::max() / 2 + 1, 1), F(-(limit::max() / 2 + 1), 1)};
+    return v;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace {
+
 const lest::test specification[] =
 {
 
@@ -51,6 +239,189 @@ const lest::test specification[] =
         EXPECT_THROWS_AS((fraction{1, limit::min()}), std::overflow_error);
         EXPECT_THROWS_AS((fraction{-1, limit::min()}), std::overflow_error);
         EXPECT(pair_type(limit::min() / -2, 1) == (fraction{limit::min(), -2})());
+        EXPECT(pair_type(-1, limit::min() / -2) == (fraction{2, limit::min()})());
+        EXPECT(pair_type(1, limit::min() / -4) == (fraction{-4, limit::min()})());
+        EXPECT(pair_type(limit::min() / -2, 3) == (fraction{limit::min(), -6})());
+        EXPECT(pair_type(limit::min() / 2, 3) == (fraction{limit::min(), 6})());
+        EXPECT(pair_type(3, limit::min() / -2) == (fraction{-6, limit::min()})());
+        EXPECT(pair_type(0, 1) == (fraction{0, limit::min()})());
+        EXPECT(pair_type(1, 1) == (fraction{limit::min(), limit::min()})());
+    },
+
+    CASE("two arguments constructor of all 8 bits pairs")
+    {
+        std::size_t mismatches = 0;
+        for (int n = -128; n <= 127; n++) {
+            for (int d = -128; d <= 127; d++) {
+                if (d == 0) {
+                    continue;
+                }
+                fraction8 thrown;
+                const ken3::fraction_errc e = error_of([&]() { thrown = fraction8(std::int8_t(n), std::int8_t(d)); });
+                fraction8 made;
+                const ken3::fraction_errc made_error = fraction8::try_make(std::int8_t(n), std::int8_t(d), made);
+                mismatches += same_as_exact(e, thrown, exact(n, d)) ? 0 : 1;
+                mismatches += same_as_exact(made_error, made, exact(n, d)) ? 0 : 1;
+            }
+        }
+        EXPECT(0UL == mismatches);
+        EXPECT(true == (fraction8(64, 63) == fraction8(-128, -126)));
+    },
+
+    CASE("constexpr")
+    {
+        using ken3::fraction;
+        using limit = std::numeric_limits<ken3::fraction::int_type>;
+
+        constexpr fraction f12(1, 2);
+        constexpr fraction f13(1, 3);
+        static_assert(fraction(5, 6) == f12 + f13, "operator+ is folded");
+        static_assert(fraction(1, 6) == f12 - f13, "operator- is folded");
+        static_assert(fraction(1, 6) == f12 * f13, "operator* is folded");
+        static_assert(fraction(3, 2) == f12 / f13, "operator/ is folded");
+        static_assert(fraction(-7, 15) == fraction(14, -30), "constructor is folded");
+        static_assert(f13 < f12, "operator< is folded");
+        static_assert(fraction(-1, 3) > fraction(-1, 2), "operator> is folded");
+        static_assert(fraction(limit::min(), 1) < fraction(limit::min() + 1, 1), "minimum value is compared");
+        static_assert(2 == fraction::int_type(fraction(5, 2)), "cast is folded");
+        static_assert(0.5 == double(f12), "cast is folded");
+        static_assert(3 == f13.denominator(), "getter is folded");
+
+        // same as run time
+        fraction f = f12;
+        f += f13;
+        EXPECT(f == f12 + f13);
+        EXPECT_THROWS_AS(fraction(limit::max(), 1) + fraction(1, 1), std::overflow_error);
+    },
+
+    CASE("wider intermediates")
+    {
+        using ken3::fraction;
+        using limit = std::numeric_limits<ken3::fraction::int_type>;
+
+        // cross products exceed 64 bits, but reduced results fit
+        EXPECT(fraction(limit::max(), 1) == fraction(limit::max(), 2) + fraction(limit::max(), 2));
+        EXPECT(fraction(limit::max(), 1) == fraction(limit::max(), 2) - fraction(limit::max(), -2));
+        EXPECT(fraction(1, 1) == fraction(limit::max(), limit::max() - 1) * fraction(limit::max() - 1, limit::max()));
+        EXPECT(fraction(limit::min(), 1) == fraction(limit::min() / 2, 1) + fraction(limit::min() / 2, 1));
+        EXPECT_THROWS_AS(fraction(limit::max(), 2) + fraction(limit::max(), 2) + fraction(1, 1), std::overflow_error);
+        EXPECT_THROWS_AS(fraction(1, limit::max()) - fraction(1, limit::max() - 1), std::overflow_error);
+    },
+
+    CASE("basic_fraction of other integers")
+    {
+        using fraction32 = ken3::basic_fraction<int>;
+        using limit32 = std::numeric_limits<int>;
+
+        EXPECT((std::pair<int, int>(5, 6)) == (fraction32(1, 2) + fraction32(1, 3))());
+        EXPECT(fraction32(limit32::max(), 1) == fraction32(limit32::max(), 2) + fraction32(limit32::max(), 2));
+        EXPECT(fraction32(limit32::max() - 1, limit32::max()) < fraction32(limit32::max(), limit32::max() - 1));
+        EXPECT_THROWS_AS(fraction32(limit32::max(), 1) + fraction32(1, 1), std::overflow_error);
+        static_assert(fraction32(1, 6) == fraction32(1, 2) * fraction32(1, 3), "basic_fraction<int> is folded");
+
+#if defined(__SIZEOF_INT128__)
+        using fraction128 = ken3::basic_fraction<__int128>;
+        using limit128 = ken3::fraction_detail::int_traits<__int128>;
+
+        // without wider type, each intermediate is checked
+        const __int128 big = static_cast<__int128>(1) << 100;
+        EXPECT(true == (fraction128(1, 2) == fraction128(big, big * 2)));
+        EXPECT(true == (fraction128(5, 6) == fraction128(1, 2) + fraction128(1, 3)));
+        EXPECT(true == (fraction128(1, big) < fraction128(1, big - 1)));
+        EXPECT(true == (fraction128(limit128::max() - 1, limit128::max()) < fraction128(limit128::max(), limit128::max() - 1)));
+        EXPECT(true == (fraction128(limit128::min(), 1) < fraction128(limit128::min() + 1, 1)));
+        EXPECT(true == (fraction128(1, big * 3) == fraction128(1, big) * fraction128(1, 3)));
+        EXPECT_THROWS_AS(fraction128(limit128::max(), 2) + fraction128(limit128::max(), 2), std::overflow_error);
+        EXPECT(true == (fraction128(-1, limit128::max() / 2 + 1) == fraction128(2, 1) / fraction128(limit128::min(), 1)));
+        EXPECT(true == (fraction128(21, limit128::max() / 2 + 1) == fraction128(-6, 5) / fraction128(limit128::min(), 35)));
+        EXPECT_THROWS_AS(fraction128(3, 1) / fraction128(limit128::min(), 1), std::overflow_error);
+        fraction128 q(-6, 5);
+        EXPECT(ken3::fraction_errc::ok == q.try_div(fraction128(limit128::min(), 35)));
+        EXPECT(true == (fraction128(21, limit128::max() / 2 + 1) == q));
+        EXPECT(ken3::fraction_errc::overflow == q.try_div(fraction128(limit128::min(), 1)));
+
+        // operator-, operator-=, and try_sub() overflow for the same operands
+        const fraction128 top(limit128::max() / 2 + 1, 1);
+        const fraction128 half(1, 2);
+        EXPECT_THROWS_AS(half - top, std::overflow_error);
+        fraction128 r = half;
+        EXPECT_THROWS_AS(r -= top, std::overflow_error);
+        EXPECT(ken3::fraction_errc::overflow == r.try_sub(top));
+        EXPECT(true == (half == r));
+        const fraction128 minus_top(-(limit128::max() / 2 + 1), 1);
+        const fraction128 minus_half(-1, 2);
+        EXPECT(true == (fraction128(limit128::max(), 2) == minus_half - minus_top));
+        r = minus_half;
+        EXPECT(ken3::fraction_errc::ok == r.try_sub(minus_top));
+        EXPECT(true == (minus_half - minus_top == r));
+        r = minus_half;
+        r -= minus_top;
+        EXPECT(true == (minus_half - minus_top == r));
+        static_assert(fraction128(1, 6) == fraction128(1, 2) - fraction128(1, 3), "basic_fraction<__int128> is folded");
+#endif
+    },
+
+    CASE("from_double()")
+    {
+        using ken3::fraction;
+        using pair_type = ken3::fraction::pair_type;
+        using limit = std::numeric_limits<ken3::fraction::int_type>;
+        using dlimit = std::numeric_limits<double>;
+
+        EXPECT(pair_type(0, 1) == fraction::from_double(0.0)());
+        EXPECT(pair_type(0, 1) == fraction::from_double(-0.0)());
+        EXPECT(pair_type(3, 8) == fraction::from_double(0.375)());
+        EXPECT(pair_type(-5, 1) == fraction::from_double(-5.0)());
+        EXPECT(pair_type(3602879701896397, 36028797018963968) == fraction::from_double(0.1)());
+        EXPECT(pair_type(1, limit::max() / 2 + 1) == fraction::from_double(std::ldexp(1.0, -62))());
+        EXPECT(pair_type(limit::min(), 1) == fraction::from_double(std::ldexp(-1.0, 63))());
+        EXPECT(pair_type(1LL << 62, 1) == fraction::from_double(std::ldexp(1.0, 62))());
+        EXPECT_THROWS_AS(fraction::from_double(std::ldexp(1.0, 63)), std::overflow_error);
+        EXPECT_THROWS_AS(fraction::from_double(std::ldexp(1.0, -63)), std::overflow_error);
+        EXPECT_THROWS_AS(fraction::from_double(1e-30), std::overflow_error);
+        EXPECT_THROWS_AS(fraction::from_double(dlimit::infinity()), std::domain_error);
+        EXPECT_THROWS_AS(fraction::from_double(dlimit::quiet_NaN()), std::domain_error);
+        EXPECT(0.1 == double(fraction::from_double(0.1)));
+
+        // results are same as Python's Fraction(x).limit_denominator(max_denominator)
+        EXPECT(pair_type(311, 99) == fraction::from_double(3.141592653589793, 100)());
+        EXPECT(pair_type(3126535, 995207) == fraction::from_double(3.141592653589793, 1000000)());
+        EXPECT(pair_type(1, 10) == fraction::from_double(0.1, 10)());
+        EXPECT(pair_type(1, 10) == fraction::from_double(0.1, 1000000000)());
+        EXPECT(pair_type(-1, 3) == fraction::from_double(-0.333, 100)());
+        EXPECT(pair_type(3, 8) == fraction::from_double(0.375, 8)());
+        EXPECT(pair_type(0, 1) == fraction::from_double(std::ldexp(1.0, -70), limit::max())());
+        EXPECT(pair_type(0, 1) == fraction::from_double(1e-30, limit::max())());
+        EXPECT(pair_type(1, 6666666666666666832) == fraction::from_double(1.5e-19, limit::max())());
+        EXPECT(pair_type(-123, 1) == fraction::from_double(-123.0, 1)());
+        EXPECT_THROWS_AS(fraction::from_double(0.5, 0), std::invalid_argument);
+        EXPECT_THROWS_AS(fraction::from_double(1e20, 100), std::overflow_error);
+        EXPECT_THROWS_AS(fraction::from_double(-dlimit::infinity(), 100), std::domain_error);
+
+        using fraction32 = ken3::basic_fraction<int>;
+        EXPECT((std::pair<int, int>(1, 10)) == fraction32::from_double(0.1, 1000)());
+        EXPECT((std::pair<int, int>(0, 1)) == fraction32::from_double(1e-30, 1000000)());
+        EXPECT((std::pair<int, int>(-1, 1077939846)) ==
+               fraction32::from_double(std::ldexp(-static_cast<double>(0x1fe018abd11b2aLL), -83), 1200988802)());
+        EXPECT_THROWS_AS(fraction32::from_double(0.1), std::overflow_error);
+        EXPECT_THROWS_AS(fraction32::from_double(3e9 + 0.5, 1000), std::overflow_error);
+        EXPECT((std::pair<int, int>(2147483647, 1)) == fraction32::from_double(2147483646.75, 2)());
+    },
+
+    CASE("limit_denominator()")
+    {
+        using ken3::fraction;
+        using pair_type = ken3::fraction::pair_type;
+        using limit = std::numeric_limits<ken3::fraction::int_type>;
+
+        EXPECT(pair_type(311, 99) == fraction(314159, 100000).limit_denominator(100)());
+        EXPECT(pair_type(-2, 3) == fraction(-7, 10).limit_denominator(3)());
+        EXPECT(pair_type(0, 1) == fraction(1, 2).limit_denominator(1)());
+        EXPECT(pair_type(-1, 1) == fraction(-1, 2).limit_denominator(1)());
+        EXPECT(pair_type(1, 1) == fraction(3, 2).limit_denominator(1)());
+        EXPECT(pair_type(7, 10) == fraction(7, 10).limit_denominator(10)());
+        EXPECT(pair_type(-1, 1) == fraction(limit::min(), limit::max()).limit_denominator(10)());
+        EXPECT_THROWS_AS(fraction(1, 2).limit_denominator(0), std::invalid_argument);
     },
 
     CASE("operator==")
@@ -102,6 +473,24 @@ const lest::test specification[] =
         EXPECT(false == ((fraction{limit::max() - 10, limit::max()}) < (fraction{limit::max() - 20, limit::max() - 1})));
         EXPECT(false == ((fraction{limit::min(), limit::max()}) < (fraction{limit::min(), limit::max()})));
         EXPECT(true == ((fraction{limit::min() + 10, limit::max()}) < (fraction{limit::min() + 20, limit::max() - 1})));
+        EXPECT(true == ((fraction{limit::max(), limit::max() - 1}) < (fraction{limit::max() - 1, limit::max() - 2})));
+        EXPECT(false == ((fraction{limit::min(), limit::max()}) < (fraction{limit::min(), limit::max() - 1})));
+        EXPECT(true == ((fraction{limit::min(), 1}) < (fraction{limit::min() + 1, 1})));
+        EXPECT(false == ((fraction{limit::max(), 1}) < (fraction{limit::min(), 1})));
+    },
+
+    CASE("sort")
+    {
+        using ken3::fraction;
+        using limit = std::numeric_limits<ken3::fraction::int_type>;
+
+        std::vector<fraction> v{{1, 2}, {-1, 3}, {limit::max(), 3}, {0, 1}, {limit::min(), 7}, {2, 5}, {1, -2}};
+        std::sort(v.begin(), v.end());
+        EXPECT((std::vector<fraction>{{limit::min(), 7}, {-1, 2}, {-1, 3}, {0, 1}, {2, 5}, {1, 2}, {limit::max(), 3}}) == v);
+        std::map<fraction, int> m{{{1, 2}, 1}, {{2, 4}, 2}, {{1, 3}, 3}};
+        EXPECT(2UL == m.size());
+        EXPECT(1 == m.begin()->first.numerator());
+        EXPECT(3 == m.begin()->first.denominator());
     },
 
     CASE("operator>")
@@ -285,6 +674,47 @@ const lest::test specification[] =
         EXPECT_THROWS_AS((fraction{limit::max() / 2 + 1, 1} / fraction{1, 3}), std::overflow_error);
         EXPECT_THROWS_AS((fraction{1, limit::min() / 2 - 1} / fraction{3, 1}), std::overflow_error);
         EXPECT_THROWS_AS((fraction{limit::min(), 1} / fraction{-1, 1}), std::overflow_error);
+
+        // numerator of rhs is the minimum value
+        EXPECT(pair_type(-1, limit::max() / 2 + 1) == (fraction{2, 1} / fraction{limit::min(), 1})());
+        EXPECT(pair_type(5, 7) == (fraction{limit::min(), 7} / fraction{limit::min(), 5})());
+        EXPECT_THROWS_AS((fraction{3, 1} / fraction{limit::min(), 1}), std::overflow_error);
+        EXPECT_THROWS_AS((fraction{-1, 1} / fraction{limit::min(), 1}), std::overflow_error);
+    },
+
+    CASE("try_make() and try_*()")
+    {
+        using ken3::fraction;
+        using ken3::fraction_errc;
+        using pair_type = ken3::fraction::pair_type;
+        using limit = std::numeric_limits<ken3::fraction::int_type>;
+
+        fraction f(1, 2);
+        EXPECT(fraction_errc::ok == fraction::try_make(14, -30, f));
+        EXPECT(pair_type(-7, 15) == f());
+        EXPECT(fraction_errc::zero_denominator == fraction::try_make(1, 0, f));
+        EXPECT(fraction_errc::overflow == fraction::try_make(limit::min(), -1, f));
+        EXPECT(pair_type(-7, 15) == f());
+
+        fraction g(limit::max(), 1);
+        EXPECT(fraction_errc::overflow == g.try_add(fraction(1, 1)));
+        EXPECT(fraction_errc::overflow == g.try_mul(fraction(2, 1)));
+        EXPECT(fraction_errc::zero_denominator == g.try_div(fraction(0, 1)));
+        EXPECT(fraction(limit::max(), 1) == g);
+        EXPECT(fraction_errc::ok == g.try_sub(fraction(limit::max(), 2)));
+        EXPECT(fraction(limit::max(), 2) == g);
+
+        EXPECT(fraction_errc::overflow == fraction(3, 1).try_div(fraction(limit::min(), 1)));
+        fraction h(2, 1);
+        EXPECT(fraction_errc::ok == h.try_div(fraction(limit::min(), 1)));
+        EXPECT(pair_type(-1, limit::max() / 2 + 1) == h());
+
+        EXPECT(0UL == exact_mismatches(samples8()));
+        EXPECT(0UL == mismatches(extremes<fraction>()));
+        EXPECT(0UL == mismatches(extremes<ken3::basic_fraction<int>>()));
+#if defined(__SIZEOF_INT128__)
+        EXPECT(0UL == mismatches(extremes<ken3::basic_fraction<__int128>>()));
+#endif
     },
 
     CASE("operator int_type()")
@@ -7,10 +7,135 @@
  * @remark  the target is C++11 or more
  */
 
+#include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <vector>
 #include "ken3/overflow.hpp"
 #include "unittest/lest.hpp"
 
+namespace {
+
+/**
+ * @brief      count mismatches of occur_*() and checked_*() against int
+ *             arithmetic and the portable code for all pairs of T.
+ * @tparam     T: 8 bits integer type
+ * @return     the number of mismatches
+ */
+template <typename T>
+int mismatches(void)
+{
+    using namespace ken3::overflow;
+    using limit = std::numeric_limits<T>;
+
+    int count = 0;
+    for (int i = limit::min(); i <= limit::max(); i++) {
+        for (int j = limit::min(); j <= limit::max(); j++) {
+            const T x = static_cast<T>(i);
+            const T y = static_cast<T>(j);
+            const int exact[3] = {i + j, i - j, i * j};
+            const bool expected[3] = {
+                (exact[0] < limit::min()) || (exact[0] > limit::max()),
+                (exact[1] < limit::min()) || (exact[1] > limit::max()),
+                (exact[2] < limit::min()) || (exact[2] > limit::max()),
+            };
+            T results[3] = {0, 0, 0};
+            const bool checked[3] = {checked_add(x, y, results[0]), checked_sub(x, y, results[1]),
+                                     checked_mul(x, y, results[2])};
+            const bool occurred[3] = {occur_add(x, y), occur_sub(x, y), occur_mul(x, y)};
+            const bool portable[3] = {overflow_detail::occur_add(x, y), overflow_detail::occur_sub(x, y),
+                                      overflow_detail::occur_mul(x, y)};
+            for (int k = 0; k < 3; k++) {
+                count += ((checked[k] != expected[k]) || (occurred[k] != expected[k]) ||
+                          (portable[k] != expected[k]) || (results[k] != static_cast<T>(exact[k]))) ? 1 : 0;
+            }
+        }
+    }
+    return count;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      count mismatches of saturating_*() and wrapping_*() against
+ *             clamped or truncated int arithmetic for all pairs of T.
+ * @tparam     T: 8 bits integer type
+ * @return     the number of mismatches
+ */
+template <typename T>
+int saturation_mismatches(void)
+{
+    using namespace ken3::overflow;
+    using limit = std::numeric_limits<T>;
+
+    int count = 0;
+    for (int i = limit::min(); i <= limit::max(); i++) {
+        for (int j = limit::min(); j <= limit::max(); j++) {
+            const T x = static_cast<T>(i);
+            const T y = static_cast<T>(j);
+            const int exact[3] = {i + j, i - j, i * j};
+            const T saturated[3] = {saturating_add(x, y), saturating_sub(x, y), saturating_mul(x, y)};
+            const T wrapped[3] = {wrapping_add(x, y), wrapping_sub(x, y), wrapping_mul(x, y)};
+            for (int k = 0; k < 3; k++) {
+                const int clamped = (exact[k] < limit::min()) ? limit::min() :
+                                    (exact[k] > limit::max()) ? limit::max() : exact[k];
+                count += ((saturated[k] != clamped) || (wrapped[k] != static_cast<T>(exact[k]))) ? 1 : 0;
+            }
+        }
+    }
+    return count;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      count mismatches of batch functions against scalar functions.
+ *             the size is not a multiple of 16 bytes, thus the rest after
+ *             SIMD blocks is also tested.
+ * @tparam     T: integer type
+ * @return     the number of mismatches
+ */
+template <typename T>
+std::size_t batch_mismatches(void)
+{
+    using namespace ken3::overflow;
+    using limit = std::numeric_limits<T>;
+
+    const T values[] = {limit::min(), T(limit::min() + 1), T(limit::min() / 2), T(0), T(1), T(2), T(3),
+                        T(limit::max() / 2), T(limit::max() - 1), limit::max(), T(limit::max() / 3)};
+    const std::size_t n = sizeof(values) / sizeof(values[0]);
+    std::vector<T> x;
+    std::vector<T> y;
+    for (std::size_t i = 0; i < n; i++) {
+        for (std::size_t j = 0; j < n; j++) {
+            x.push_back(values[i]);
+            y.push_back(values[j]);
+        }
+    }
+    std::vector<std::vector<T>> results(6, std::vector<T>(x.size()));
+    saturating_add(x.data(), y.data(), results[0].data(), x.size());
+    saturating_sub(x.data(), y.data(), results[1].data(), x.size());
+    saturating_mul(x.data(), y.data(), results[2].data(), x.size());
+    wrapping_add(x.data(), y.data(), results[3].data(), x.size());
+    wrapping_sub(x.data(), y.data(), results[4].data(), x.size());
+    wrapping_mul(x.data(), y.data(), results[5].data(), x.size());
+
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < x.size(); i++) {
+        const T expected[6] = {saturating_add(x[i], y[i]), saturating_sub(x[i], y[i]), saturating_mul(x[i], y[i]),
+                               wrapping_add(x[i], y[i]), wrapping_sub(x[i], y[i]), wrapping_mul(x[i], y[i])};
+        for (std::size_t k = 0; k < 6; k++) {
+            count += (expected[k] != results[k][i]) ? 1 : 0;
+        }
+    }
+
+    // in place
+    saturating_add(x.data(), y.data(), x.data(), x.size());
+    count += (x != results[0]) ? 1 : 0;
+    return count;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace {
+
 const lest::test specification[] =
 {
 
@@ -107,6 +232,76 @@ const lest::test specification[] =
         EXPECT(false == occur_abs(b));
     },
 
+    CASE("checked_add(), checked_sub() and checked_mul()")
+    {
+        using namespace ken3::overflow;
+        using limit = std::numeric_limits<std::int64_t>;
+        std::int64_t r = 0;
+
+        EXPECT(false == checked_mul(std::int64_t(1000), std::int64_t(3), r));
+        EXPECT(3000 == r);
+        EXPECT(true == checked_add(limit::max(), std::int64_t(1), r));
+        EXPECT(limit::min() == r);
+        EXPECT(true == checked_sub(limit::min(), std::int64_t(1), r));
+        EXPECT(limit::max() == r);
+        EXPECT(true == checked_mul(limit::min(), std::int64_t(-1), r));
+        EXPECT(limit::min() == r);
+        EXPECT(false == checked_mul(limit::min(), std::int64_t(1), r));
+        EXPECT(limit::min() == r);
+
+        std::uint64_t u = 0;
+        EXPECT(true == checked_sub(std::uint64_t(3), std::uint64_t(4), u));
+        EXPECT(std::numeric_limits<std::uint64_t>::max() == u);
+        EXPECT(true == checked_mul(std::uint64_t(1) << 32, std::uint64_t(1) << 32, u));
+        EXPECT(0U == u);
+
+        static_assert(occur_mul(limit::max(), std::int64_t(2)), "usable in constant expressions");
+        static_assert(not occur_add(limit::max(), std::int64_t(0)), "usable in constant expressions");
+    },
+
+    CASE("same as exact results for all 8 bits integers")
+    {
+        EXPECT(0 == mismatches<std::int8_t>());
+        EXPECT(0 == mismatches<std::uint8_t>());
+    },
+
+    CASE("saturating_*() and wrapping_*()")
+    {
+        using namespace ken3::overflow;
+        using limit = std::numeric_limits<std::int64_t>;
+        using ulimit = std::numeric_limits<std::uint64_t>;
+
+        EXPECT(32767 == saturating_add(std::int16_t(30000), std::int16_t(10000)));
+        EXPECT(-25536 == wrapping_add(std::int16_t(30000), std::int16_t(10000)));
+        EXPECT(limit::max() == saturating_add(limit::max(), std::int64_t(1)));
+        EXPECT(limit::min() == saturating_sub(limit::min(), std::int64_t(1)));
+        EXPECT(limit::max() == saturating_sub(std::int64_t(0), limit::min()));
+        EXPECT(limit::max() == saturating_mul(limit::min(), std::int64_t(-1)));
+        EXPECT(limit::min() == saturating_mul(limit::max(), std::int64_t(-2)));
+        EXPECT(limit::min() == wrapping_mul(limit::min(), std::int64_t(-1)));
+        EXPECT(ulimit::max() == saturating_add(ulimit::max(), std::uint64_t(1)));
+        EXPECT(0U == saturating_sub(std::uint64_t(3), std::uint64_t(4)));
+        EXPECT(ulimit::max() == wrapping_sub(std::uint64_t(3), std::uint64_t(4)));
+        EXPECT(ulimit::max() == saturating_mul(ulimit::max(), std::uint64_t(2)));
+        EXPECT(0 == saturation_mismatches<std::int8_t>());
+        EXPECT(0 == saturation_mismatches<std::uint8_t>());
+
+        static_assert(saturating_mul(std::int8_t(-100), std::int8_t(2)) == -128, "usable in constant expressions");
+        static_assert(wrapping_add(std::uint8_t(200), std::uint8_t(100)) == 44, "usable in constant expressions");
+    },
+
+    CASE("batch saturating_*() and wrapping_*()")
+    {
+        EXPECT(0UL == batch_mismatches<std::int8_t>());
+        EXPECT(0UL == batch_mismatches<std::uint8_t>());
+        EXPECT(0UL == batch_mismatches<std::int16_t>());
+        EXPECT(0UL == batch_mismatches<std::uint16_t>());
+        EXPECT(0UL == batch_mismatches<std::int32_t>());
+        EXPECT(0UL == batch_mismatches<std::uint32_t>());
+        EXPECT(0UL == batch_mismatches<std::int64_t>());
+        EXPECT(0UL == batch_mismatches<std::uint64_t>());
+    },
+
 };
 
 int main(int argc, char* argv[])
@@ -0,0 +1,169 @@
+/**
+ * @file    unittest/pystr/builder_test.cpp
+ * @brief   Testing ken3::pystr::builder using lest.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ */
+
+#include <chrono>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+#include "ken3/pystr.hpp"
+#include "ken3/pystr/builder.hpp"
+#include "unittest/lest.hpp"
+
+const lest::test specification[] =
+{
+
+    CASE("constructor and str()")
+    {
+        using namespace ken3::pystr;
+
+        EXPECT(std::string("") == builder().str());
+        EXPECT(0 == len(builder()));
+        EXPECT("abc" == builder("abc").str());
+        EXPECT("abc" == builder(std::string("abc")).str());
+        EXPECT(3 == len(builder("abc")));
+        EXPECT(std::string("") == builder("").str());
+    },
+
+    CASE("add() with builder")
+    {
+        using namespace ken3::pystr;
+
+        EXPECT(add("abc", "de") == add(builder("abc"), "de").str());
+        EXPECT(add("abc", "") == add(builder("abc"), "").str());
+        EXPECT(add("", "de") == add(builder(), "de").str());
+        EXPECT(add("abc", "de") == add(builder("abc"), builder("de")).str());
+        EXPECT(5 == len(add(builder("abc"), "de")));
+
+        builder b;
+        std::string s;
+        for (int i = 0; i < 1000; i++) {
+            b = add(std::move(b), std::to_string(i));
+            s = add(s, std::to_string(i));
+        }
+        EXPECT(s == b.str());
+        EXPECT(len(s) == len(b));
+    },
+
+    CASE("copies of builder")
+    {
+        using namespace ken3::pystr;
+
+        // copies share recorded pieces, and each of them is kept
+        builder b("abc");
+        builder c = add(b, "de");
+        builder d = add(b, "fg");
+        b.append("h");
+        EXPECT("abcde" == c.str());
+        EXPECT("abcfg" == d.str());
+        EXPECT("abch" == b.str());
+        builder e = mul(c, 2);
+        c.repeat(3);
+        EXPECT(mul("abcde", 2) == e.str());
+        EXPECT(mul("abcde", 3) == c.str());
+
+        // without std::move(), a long list of pieces is built and released
+        builder many;
+        for (int i = 0; i < 1000000; i++) {
+            many = add(many, "x");
+        }
+        EXPECT(mul("x", 1000000) == many.str());
+    },
+
+    CASE("prepending and nesting builder")
+    {
+        using namespace ken3::pystr;
+
+        // a large text piece is shared instead of copied, thus prepending
+        // in a loop is linear
+        auto start = std::chrono::steady_clock::now();
+        builder wrapped("x");
+        for (int i = 0; i < 100000; i++) {
+            wrapped = add(add(builder("<"), wrapped), ">");
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        EXPECT(elapsed.count() < 1.0);
+        EXPECT(mul("<", 100000) + "x" + mul(">", 100000) == wrapped.str());
+
+        // deeply nested groups are rendered and released without recursion
+        builder nested(mul("y", 300));
+        for (int i = 0; i < 200000; i++) {
+            nested = add(add(builder("["), nested), "]");
+        }
+        EXPECT(mul("[", 200000) + mul("y", 300) + mul("]", 200000) == nested.str());
+        nested = builder();
+        EXPECT(std::string("") == nested.str());
+
+        // repeat(1) changes nothing
+        builder once;
+        for (int i = 0; i < 1000000; i++) {
+            once = mul(add(once, "y"), 1);
+        }
+        EXPECT(mul("y", 1000000) == once.str());
+    },
+
+    CASE("mul() and rmul() with builder")
+    {
+        using namespace ken3::pystr;
+
+        for (int n = -1; n < 10; n++) {
+            EXPECT(mul("abc", n) == mul(builder("abc"), n).str());
+            EXPECT(rmul("abc", n) == rmul(builder("abc"), n).str());
+            EXPECT(mul("", n) == mul(builder(), n).str());
+            EXPECT(len(mul("abc", n)) == len(mul(builder("abc"), n)));
+        }
+        EXPECT(mul("abc", 6) == mul(mul(builder("abc"), 2), 3).str());
+        EXPECT(mul("a", 1000000) == mul(builder("a"), 1000000).str());
+
+        const index_type huge = std::numeric_limits<index_type>::max() / 2;
+        EXPECT_THROWS_AS(mul(builder("abc"), huge), ken3::py::OverflowError);
+        EXPECT_THROWS_AS(mul(mul(builder("abc"), 1 << 30), index_type(1) << 32), ken3::py::OverflowError);
+        EXPECT(0 == len(mul(builder(), huge)));
+    },
+
+    CASE("join() with builder")
+    {
+        using namespace ken3::pystr;
+
+        EXPECT(join(",", {"a", "b", "c"}) == join(",", {builder("a"), builder("b"), builder("c")}).str());
+        EXPECT(join(",", {"a"}) == join(",", {builder("a")}).str());
+        EXPECT(join(",", std::vector<std::string>()) == join(",", std::vector<builder>()).str());
+        EXPECT(join("", {"a", "", "c"}) == join("", {builder("a"), builder(), builder("c")}).str());
+    },
+
+    CASE("mixed operations")
+    {
+        using namespace ken3::pystr;
+
+        builder row = add(add(builder("<td>"), "x"), "</td>");
+        builder table = mul(add(add(builder("<tr>"), mul(row, 3)), "</tr>"), 2);
+        std::string expected = mul("<tr>" + mul("<td>x</td>", 3) + "</tr>", 2);
+        EXPECT(expected == table.str());
+        EXPECT(len(expected) == len(table));
+
+        // appended groups are kept after the source is modified
+        builder doc = add(add(builder("["), table), "]");
+        table = mul(std::move(table), 0);
+        EXPECT("[" + expected + "]" == doc.str());
+        EXPECT(std::string("") == table.str());
+
+        builder twice("ab");
+        twice.append(twice);
+        EXPECT("abab" == twice.str());
+        twice.append("c").append(twice).repeat(2);
+        EXPECT(mul("ababcababc", 2) == twice.str());
+    },
+
+};
+
+int main(int argc, char* argv[])
+{
+    return lest::run(specification, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
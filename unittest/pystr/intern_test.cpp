@@ -0,0 +1,124 @@
+/**
+ * @file    unittest/pystr/intern_test.cpp
+ * @brief   Testing ken3::pystr::intern using lest.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ */
+
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include "ken3/pystr.hpp"
+#include "ken3/pystr/intern.hpp"
+#include "unittest/lest.hpp"
+
+const lest::test specification[] =
+{
+
+    CASE("intern() returns same handle for same string")
+    {
+        using namespace ken3::pystr;
+
+        EXPECT(intern("abc") == intern("abc"));
+        EXPECT(intern("abc") == intern(std::string("ab") + "c"));
+        EXPECT(intern("abc") != intern("ABC"));
+        EXPECT(intern("") == interned());
+        EXPECT("abc" == intern("abc").str());
+        EXPECT(std::string("") == interned().str());
+    },
+
+    CASE("eq() and ne() with interned strings")
+    {
+        using namespace ken3::pystr;
+
+        EXPECT(true == eq(intern("a"), intern("a")));
+        EXPECT(false == eq(intern("a"), intern("A")));
+        EXPECT(false == eq(intern("a"), intern("")));
+        EXPECT(false == ne(intern("a"), intern("a")));
+        EXPECT(true == ne(intern("a"), intern("A")));
+    },
+
+    CASE("interned works with other pystr functions")
+    {
+        using namespace ken3::pystr;
+
+        interned s = intern("a,b,c");
+        EXPECT(5 == len(s));
+        EXPECT(3U == split(s, ",").size());
+        EXPECT(true == startswith(s, "a,"));
+        EXPECT("A,B,C" == upper(s.str()));
+    },
+
+    CASE("cached transforms")
+    {
+        using namespace ken3::pystr;
+
+        const std::vector<std::string> sources{
+            "", " ", "abc", "  aBc De  ", "HELLO world", "\t x \t", "1st 2nd",
+        };
+        for (const auto& i: sources) {
+            interned s = intern(i);
+            for (int loop = 0; loop < 2; loop++) { // 2nd loop uses cache
+                EXPECT(intern(capitalize(i)) == capitalize(s));
+                EXPECT(intern(casefold(i)) == casefold(s));
+                EXPECT(intern(lower(i)) == lower(s));
+                EXPECT(intern(lstrip(i)) == lstrip(s));
+                EXPECT(intern(rstrip(i)) == rstrip(s));
+                EXPECT(intern(strip(i)) == strip(s));
+                EXPECT(intern(swapcase(i)) == swapcase(s));
+                EXPECT(intern(title(i)) == title(s));
+                EXPECT(intern(upper(i)) == upper(s));
+            }
+            EXPECT(intern(lstrip(i, "\t ")) == lstrip(s, "\t "));
+            EXPECT(intern(rstrip(i, "\t ")) == rstrip(s, "\t "));
+            EXPECT(intern(strip(i, "\t ")) == strip(s, "\t "));
+        }
+        EXPECT(intern("key") == lower(strip(intern("  KeY "))));
+    },
+
+    CASE("std::hash of interned")
+    {
+        using namespace ken3::pystr;
+
+        std::unordered_set<interned> set{intern("a"), intern("b"), intern("a")};
+        EXPECT(2U == set.size());
+        EXPECT(1U == set.count(intern("b")));
+        EXPECT(0U == set.count(intern("c")));
+    },
+
+    CASE("intern() from multi threads")
+    {
+        using namespace ken3::pystr;
+
+        const int thread_size = 8;
+        const int key_size = 1000;
+        std::vector<std::vector<interned>> results(thread_size);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < thread_size; i++) {
+            threads.emplace_back([&results, i] {
+                for (int j = 0; j < key_size; j++) {
+                    results[i].push_back(lower(intern("Thread Key " + std::to_string(j))));
+                }
+            });
+        }
+        for (auto& i: threads) {
+            i.join();
+        }
+
+        for (int j = 0; j < key_size; j++) {
+            interned expected = intern("thread key " + std::to_string(j));
+            for (int i = 0; i < thread_size; i++) {
+                EXPECT(expected == results[i][j]);
+            }
+        }
+    },
+
+};
+
+int main(int argc, char* argv[])
+{
+    return lest::run(specification, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,205 @@
+/**
+ * @file    unittest/pystr/parallel_test.cpp
+ * @brief   Testing ken3::pystr::parallel using lest.
+ * @author  toda
+ * @date    2026-10-19
+ * @version 0.1.0
+ * @remark  the target is C++11 or more
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "ken3/pystr.hpp"
+#include "ken3/pystr/parallel.hpp"
+#include "unittest/lest.hpp"
+
+namespace {
+
+using ken3::pystr::index_type;
+using ken3::pystr::None;
+
+/**
+ * @brief      adjust start and end by the same rule as CPython.
+ */
+void adjust(index_type size, index_type& start, index_type& end)
+{
+    end = (end == None || end > size) ? size : (end < 0) ? std::max<index_type>(end + size, 0) : end;
+    start = (start == None) ? 0 : (start < 0) ? std::max<index_type>(start + size, 0) : start;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      serial str.count() as reference.
+ */
+index_type count_ref(const std::string& self, const std::string& sub, index_type start, index_type end)
+{
+    adjust(static_cast<index_type>(self.size()), start, end);
+    index_type m = static_cast<index_type>(sub.size());
+    if (end - start < m) {
+        return 0;
+    }
+    if (m == 0) {
+        return end - start + 1;
+    }
+    index_type counter = 0;
+    for (index_type i = start; i + m <= end; i++) {
+        if (self.compare(i, m, sub) == 0) {
+            counter++;
+            i += m - 1;
+        }
+    }
+    return counter;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      serial str.find() as reference.
+ */
+index_type find_ref(const std::string& self, const std::string& sub, index_type start, index_type end)
+{
+    adjust(static_cast<index_type>(self.size()), start, end);
+    index_type m = static_cast<index_type>(sub.size());
+    for (index_type i = start; i + m <= end; i++) {
+        if (self.compare(i, m, sub) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      measure the best elapsed time of func in some trials.
+ * @return     elapsed seconds
+ */
+double best_seconds(const std::function<void(void)>& func)
+{
+    double best = 0.0;
+    for (int i = 0; i < 3; i++) {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = (i == 0) ? elapsed.count() : std::min(best, elapsed.count());
+    }
+    return best;
+}
+/////////////////////////////////////////////////////////////////////////////
+
+} // namespace {
+
+const lest::test specification[] =
+{
+
+    CASE("count() and find() return Python results")
+    {
+        using namespace ken3::pystr::parallel;
+
+        thread_pool pool(3);
+        EXPECT(2 == count("aaaa", "aa", None, None, pool, 1));
+        EXPECT(2 == count("aaaaa", "aa", None, None, pool, 1));
+        EXPECT(1 == count("abc", "", 3, None, pool, 1));
+        EXPECT(0 == count("abc", "", 4, None, pool, 1));
+        EXPECT(4 == count("abc", "", None, None, pool, 1));
+        EXPECT(0 == count("abc", "abcd", None, None, pool, 1));
+        EXPECT(3 == find("abcabc", "", 3, None, pool, 1));
+        EXPECT(-1 == find("abc", "", 5, None, pool, 1));
+        EXPECT(3 == find("abcabc", "abc", 1, None, pool, 1));
+        EXPECT(-1 == find("abcabc", "abc", 1, -1, pool, 1));
+        EXPECT(3 == find("abcabc", "abc", -3, None, pool, 1));
+        EXPECT(2 == count("abcabc", "abc"));
+        EXPECT(0 == find("abcabc", "abc"));
+    },
+
+    CASE("count() and find() with needles spanning chunk boundaries")
+    {
+        using namespace ken3::pystr::parallel;
+
+        std::mt19937 gen(1);
+        const std::vector<std::string> subs{"a", "aa", "aaa", "ab", "aba", "abab", "baab", "aaaaaaaa"};
+        thread_pool pool(3);
+        for (int loop = 0; loop < 200; loop++) {
+            std::string s;
+            std::size_t size = gen() % 64;
+            for (std::size_t i = 0; i < size; i++) {
+                s += (gen() % 4 == 0) ? 'b' : 'a';
+            }
+            index_type len = static_cast<index_type>(size);
+            const std::vector<index_type> indexes{None, -len - 2, -3, 0, 1, 5, len - 1, len, len + 2};
+            for (const auto& sub: subs) {
+                for (std::size_t chunk: {1, 2, 3, 7, 1 << 20}) {
+                    for (const auto& start: indexes) {
+                        for (const auto& end: indexes) {
+                            EXPECT(count_ref(s, sub, start, end) == count(s, sub, start, end, pool, chunk));
+                            EXPECT(find_ref(s, sub, start, end) == find(s, sub, start, end, pool, chunk));
+                        }
+                    }
+                }
+            }
+        }
+    },
+
+    CASE("count() and find() are same as pystr on large string")
+    {
+        using namespace ken3::pystr;
+
+        std::string s = mul("The quick brown fox jumps over the lazy dog.\n", 100000) + "vow?";
+        EXPECT(count(s, "o") == parallel::count(s, "o", None, None, parallel::default_pool(), 4096));
+        EXPECT(count(s, "fox j", 7) == parallel::count(s, "fox j", 7, None, parallel::default_pool(), 4096));
+        EXPECT(find(s, "vow?") == parallel::find(s, "vow?", None, None, parallel::default_pool(), 4096));
+        EXPECT(find(s, "lazy", 1000) == parallel::find(s, "lazy", 1000, None, parallel::default_pool(), 4096));
+    },
+
+    CASE("count() of periodic needle is not much slower than pystr")
+    {
+        using namespace ken3::pystr;
+
+        // matches span all chunk boundaries, and the chains from both sides
+        // of each boundary never meet.
+        const std::string s(16 << 20, 'a');
+        const std::string sub(500, 'a');
+        index_type serial_count = 0;
+        index_type parallel_count = 0;
+        double serial = best_seconds([&]() { serial_count = count(s, sub); });
+        double parallel = best_seconds([&]() { parallel_count = parallel::count(s, sub); });
+        EXPECT(serial_count == parallel_count);
+        EXPECT(parallel < serial * 8 + 0.01);
+    },
+
+    CASE("thread_pool")
+    {
+        using namespace ken3::pystr::parallel;
+
+        for (std::size_t size: {0, 1, 4}) {
+            thread_pool pool(size);
+            EXPECT(size == pool.size());
+
+            std::vector<std::atomic<int>> called(1000);
+            for (auto& i: called) {
+                i = 0;
+            }
+            pool.parallel_for(called.size(), [&called](std::size_t i) { called[i]++; });
+            for (auto& i: called) {
+                EXPECT(1 == i.load());
+            }
+            pool.parallel_for(0, [](std::size_t) { throw std::runtime_error("not called"); });
+            EXPECT_THROWS_AS(pool.parallel_for(10, [](std::size_t i) {
+                if (i == 5) {
+                    throw std::runtime_error("error");
+                }
+            }), std::runtime_error);
+        }
+    },
+
+};
+
+int main(int argc, char* argv[])
+{
+    return lest::run(specification, argc, argv);
+}
+/////////////////////////////////////////////////////////////////////////////
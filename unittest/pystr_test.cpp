@@ -208,6 +208,10 @@ const lest::test specification[] =
         EXPECT(std::string("'abc'") == repr("abc"));
         EXPECT(std::string("'\\r\\n\\t'") == repr("\r\n\t"));
         EXPECT(std::string("''") == repr(""));
+        EXPECT(std::string("'abcdefghijklmnopqrstuvwxyz\\\\0123456789'") == repr("abcdefghijklmnopqrstuvwxyz\\0123456789"));
+        EXPECT(std::string("'abcdefghijklmnopqrstuvwxyz0123456789\\x7f'") == repr("abcdefghijklmnopqrstuvwxyz0123456789\x7f"));
+        EXPECT(std::string("'\"abcdefghijklmnopqrstuvwxyz\\'0123456789'") == repr("\"abcdefghijklmnopqrstuvwxyz'0123456789"));
+        EXPECT(std::string("'abcdefghijklmnopq\\x1fz0123456789\\x80'") == repr("abcdefghijklmnopq\x1fz0123456789\x80"));
     },
 
     CASE("rmul()")
@@ -166,6 +166,14 @@ TEST_MAP = OrderedDict((
         ("'abc'.__repr__()", 'repr("abc")'),
         ("'\\r\\n\\t'.__repr__()", 'repr("\\r\\n\\t")'),
         ("''.__repr__()", 'repr("")'),
+        ("'abcdefghijklmnopqrstuvwxyz\\\\0123456789'.__repr__()",
+         'repr("abcdefghijklmnopqrstuvwxyz\\\\0123456789")'),
+        ("'abcdefghijklmnopqrstuvwxyz0123456789\\x7f'.__repr__()",
+         'repr("abcdefghijklmnopqrstuvwxyz0123456789\\x7f")'),
+        ("'\"abcdefghijklmnopqrstuvwxyz\\'0123456789'.__repr__()",
+         'repr("\\"abcdefghijklmnopqrstuvwxyz\'0123456789")'),
+        ("'abcdefghijklmnopq\\x1fz0123456789\\x80'.__repr__()",
+         'repr("abcdefghijklmnopq\\x1fz0123456789\\x80")'),
     )),
     ('rmul()', (
         ("'a'.__rmul__(3)", 'rmul("a", 3)'),